@@ -0,0 +1,78 @@
+/***************************************************************************
+* Example sketch for the ADS1115_WE library
+*
+* This sketch shows how one task measures four channels and publishes them to 
+* other tasks, which read the latest samples without any I2C access. On an ESP32
+* the acquisition runs in a FreeRTOS task of its own, and the bus is protected 
+* with a recursive mutex, so that other tasks can use the bus as well. On other 
+* boards, loop() calls step() instead.
+*  
+* Further information can be found on:
+* https://wolles-elektronikkiste.de/ads1115 (German)
+* https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+* 
+***************************************************************************/
+
+#include<ADS1115_WE.h> 
+#include<ADS1115_AcquisitionTask.h>
+#include<Wire.h>
+#define I2C_ADDRESS 0x48
+
+ADS1115_WE adc = ADS1115_WE(I2C_ADDRESS);
+ADS1115_SharedSamples<4> latest;   // the latest set of samples
+ADS1115_AcquisitionTask acquisition(adc, latest);
+const ADS1115_MUX channels[4] = {ADS1115_COMP_0_GND, ADS1115_COMP_1_GND, ADS1115_COMP_2_GND, ADS1115_COMP_3_GND};
+
+#ifdef ESP32
+SemaphoreHandle_t busMutex;
+
+void acquisitionTask(void *){
+  acquisition.run(); // runs until acquisition.stop()
+}
+#endif
+
+void setup() {
+  Wire.begin();
+  Serial.begin(115200);
+#ifdef ESP32
+  busMutex = xSemaphoreCreateRecursiveMutex();
+  adc.setBusLock([](void *m){ xSemaphoreTakeRecursive((SemaphoreHandle_t)m, portMAX_DELAY); },
+                 [](void *m){ xSemaphoreGiveRecursive((SemaphoreHandle_t)m); }, busMutex);
+#endif
+  if(!adc.init()){
+    Serial.println("ADS1115 not connected!");
+  }
+  adc.setVoltageRange_mV(ADS1115_RANGE_6144);
+  adc.setConvRate(ADS1115_250_SPS);
+  acquisition.begin(channels, 4);
+#ifdef ESP32
+  xTaskCreate(acquisitionTask, "ads1115", 4096, nullptr, 2, nullptr);
+#endif
+  
+  Serial.println("ADS1115 Example Sketch - Acquisition Task");
+  Serial.println();
+}
+
+void loop() {
+  static unsigned long lastOutput = 0;
+#ifndef ESP32
+  acquisition.step(); // no RTOS: measure the next set here
+#endif
+  
+  if(millis() - lastOutput >= 1000){
+    lastOutput = millis();
+    ADS1115_Sample samples[4];
+    uint32_t timestamp;
+    uint32_t set = latest.read(samples, 4, &timestamp); // no I2C access
+    Serial.print("Set ");
+    Serial.print(set);
+    Serial.print(" (");
+    Serial.print(timestamp);
+    Serial.print(" µs): ");
+    for(int i=0; i<4; i++){
+      Serial.print(samples[i].raw * ADS1115_WE::rangeToMillivolts(samples[i].range) / 32768.0);
+      Serial.print(" mV  ");
+    }
+    Serial.println();
+  }
+}
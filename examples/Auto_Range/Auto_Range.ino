@@ -166,7 +166,7 @@ void readChannel(ADS1115_MUX channel) {
   //adc.setAutoRange(); //use either this or setPermanentAutoRangeMode(true)
   
   adc.startSingleMeasurement(); // comment out when changing to continuous mode
-  while(adc.isBusy()){delay(0);}  // comment out when changing to continuous mode
+  adc.waitForConversion();
   voltage = adc.getResult_V(); // alternative: getResult_mV for Millivolt
   printVoltageRange(); // this is just to show that the range is changing with changing voltages 
   Serial.println(voltage);
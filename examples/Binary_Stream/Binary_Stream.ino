@@ -0,0 +1,71 @@
+/***************************************************************************
+* Example sketch for the ADS1115_WE library
+*
+* This sketch shows how to stream the raw results of four channels in binary
+* frames instead of text. The ADS1115_Scanner measures AIN0 to AIN3 at 860 SPS,
+* the encoder packs 16 sets of four samples into one frame (142 bytes instead
+* of approx. 350 bytes as text). Even four ADS1115 at 860 SPS each would fit
+* through 115200 baud this way (approx. 7600 bytes/s), with delta coding
+* (useDelta = true) noise-free signals need even less.
+*
+* The frames are not readable in the serial monitor. The format is described in
+* ADS1115_FrameEncoder.h, a decoder (C++) can be found in extras/host.
+*
+* Further information can be found on:
+* https://wolles-elektronikkiste.de/ads1115 (German)
+* https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+*
+***************************************************************************/
+
+#include<ADS1115_WE.h>
+#include<ADS1115_Scanner.h>
+#include<ADS1115_FrameEncoder.h>
+#include<Wire.h>
+#define I2C_ADDRESS 0x48
+
+ADS1115_WE adc = ADS1115_WE(I2C_ADDRESS);
+ADS1115_Scanner scanner(adc);
+
+const ADS1115_MUX channels[] = {ADS1115_COMP_0_GND, ADS1115_COMP_1_GND, ADS1115_COMP_2_GND, ADS1115_COMP_3_GND};
+const uint8_t sources[] = {
+  ADS1115_FrameEncoder::source(ADS1115_COMP_0_GND, ADS1115_RANGE_6144),
+  ADS1115_FrameEncoder::source(ADS1115_COMP_1_GND, ADS1115_RANGE_6144),
+  ADS1115_FrameEncoder::source(ADS1115_COMP_2_GND, ADS1115_RANGE_6144),
+  ADS1115_FrameEncoder::source(ADS1115_COMP_3_GND, ADS1115_RANGE_6144)
+};
+const uint8_t setsPerFrame = 16;
+const bool useDelta = false;
+
+uint8_t frameBuffer[160];
+ADS1115_FrameEncoder encoder(frameBuffer, sizeof(frameBuffer));
+uint8_t sets = 0;
+
+void setup() {
+  Wire.begin();
+  Wire.setClock(400000);
+  Serial.begin(115200);
+  if(!adc.init()){
+    Serial.println("ADS1115 not connected!");
+  }
+  adc.setVoltageRange_mV(ADS1115_RANGE_6144);
+  adc.setConvRate(ADS1115_860_SPS);
+  scanner.begin(channels, 4);
+}
+
+void loop() {
+  if(!scanner.update()){
+    return;
+  }
+  if(sets == 0){
+    encoder.beginFrame(sources, 4, micros(), useDelta);
+  }
+  for(uint8_t i=0; i<4; i++){
+    encoder.addSample(scanner.getRawResult(i));
+  }
+  if(++sets == setsPerFrame){
+    encoder.endFrame(micros());
+    Serial.write(encoder.data(), encoder.length());
+    encoder.clear();
+    sets = 0;
+  }
+}
@@ -0,0 +1,64 @@
+/***************************************************************************
+* Example sketch for the ADS1115_WE library
+*
+* This sketch shows how to capture a waveform with readBlock(). It reads 
+* 128 consecutive conversions at 860 SPS into an array, including the time 
+* at which each result was ready. 
+* If the ALERT/RDY pin is connected and set with setReadyPin(), the ADS1115 
+* runs in continuous mode and readBlock() reaches the full data rate. Without 
+* it, single shot conversions are chained, which is a bit slower. 
+*  
+* Further information can be found on:
+* https://wolles-elektronikkiste.de/ads1115 (German)
+* https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+* 
+***************************************************************************/
+
+#include<ADS1115_WE.h> 
+#include<Wire.h>
+#define I2C_ADDRESS 0x48
+#define BLOCK_SIZE 128
+int readyPin = 2;
+
+ADS1115_WE adc = ADS1115_WE(I2C_ADDRESS);
+int16_t samples[BLOCK_SIZE];
+uint32_t timestamps[BLOCK_SIZE];
+
+void setup() {
+  Wire.begin();
+  Wire.setClock(400000);
+  Serial.begin(115200);
+  pinMode(readyPin, INPUT_PULLUP);
+  if(!adc.init()){
+    Serial.println("ADS1115 not connected!");
+  }
+  adc.setVoltageRange_mV(ADS1115_RANGE_6144);
+  adc.setCompareChannels(ADS1115_COMP_3_GND);
+  adc.setConvRate(ADS1115_860_SPS);
+  adc.setReadyPin(readyPin); // comment out if the ALERT/RDY pin is not connected
+  
+  Serial.println("ADS1115 Example Sketch - Block Read");
+  Serial.println();
+}
+
+void loop() {
+  size_t count = adc.readBlock(samples, BLOCK_SIZE, timestamps);
+  
+  Serial.print("Results: ");
+  Serial.print(count);
+  Serial.print(", missed conversions: ");
+  Serial.print(adc.getMissedConversions());
+  if(count > 1){
+    Serial.print(", samples/s: ");
+    Serial.print((count - 1) * 1000000.0 / (timestamps[count - 1] - timestamps[0]));
+  }
+  Serial.println();
+  for(size_t i=0; i<count; i+=16){
+    Serial.print(timestamps[i] - timestamps[0]);
+    Serial.print(" µs: ");
+    Serial.print(samples[i] * (6144.0 / 32768.0));
+    Serial.println(" mV");
+  }
+  Serial.println("-------------------------------");
+  delay(2000);
+}
@@ -0,0 +1,63 @@
+/***************************************************************************
+* Example sketch for the ADS1115_WE library
+*
+* This sketch shows how to calculate minimum, maximum, mean, standard 
+* deviation and RMS of a channel over many results without storing them. 
+* Every result of channel 3 which is read with getRawResult() (or a function 
+* based on it, like getResult_mV()) is added to the statistics object. The 
+* conversion into millivolts only happens when snapshotAndReset() is called. 
+*  
+* Further information can be found on:
+* https://wolles-elektronikkiste.de/ads1115 (German)
+* https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+* 
+***************************************************************************/
+
+#include<ADS1115_WE.h> 
+#include<ADS1115_Statistics.h>
+#include<Wire.h>
+#define I2C_ADDRESS 0x48
+
+ADS1115_WE adc = ADS1115_WE(I2C_ADDRESS);
+ADS1115_Statistics channel3Stats;
+
+void setup() {
+  Wire.begin();
+  Wire.setClock(400000);
+  Serial.begin(115200);
+  if(!adc.init()){
+    Serial.println("ADS1115 not connected!");
+  }
+  adc.setVoltageRange_mV(ADS1115_RANGE_6144);
+  adc.setCompareChannels(ADS1115_COMP_3_GND);
+  adc.setConvRate(ADS1115_860_SPS);
+  adc.attachStatistics(channel3Stats, ADS1115_COMP_3_GND);
+  
+  Serial.println("ADS1115 Example Sketch - Channel Statistics");
+  Serial.println();
+}
+
+void loop() {
+  static unsigned long lastOutput = 0;
+  
+  adc.startSingleMeasurement();
+  adc.waitForConversion();
+  adc.getRawResult(); // the result is added to channel3Stats
+
+  if(millis() - lastOutput >= 2000){
+    lastOutput = millis();
+    ADS1115_ChannelStats stats = channel3Stats.snapshotAndReset();
+    Serial.print("Results: ");
+    Serial.print(stats.count);
+    Serial.print(", min [mV]: ");
+    Serial.print(stats.min_mV);
+    Serial.print(", max [mV]: ");
+    Serial.print(stats.max_mV);
+    Serial.print(", mean [mV]: ");
+    Serial.print(stats.mean_mV);
+    Serial.print(", std. dev. [mV]: ");
+    Serial.print(stats.stdDev_mV);
+    Serial.print(", RMS [mV]: ");
+    Serial.println(stats.rms_mV);
+  }
+}
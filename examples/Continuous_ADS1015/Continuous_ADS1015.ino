@@ -22,10 +22,9 @@
 ADS1015_WE adc = ADS1015_WE(I2C_ADDRESS);
 
 void setup() {
-  bool useADS1015 = true;
   Wire.begin();
   Serial.begin(115200);
-  if(!adc.init(useADS1015)){ // passing true will tell the lib that an ADS1015 is used
+  if(!adc.init()){ // an ADS1015_WE object knows that it controls an ADS1015
     Serial.println("ADS1015 not connected!");
   }
 
@@ -161,5 +160,6 @@ float readChannel(ADS1015_MUX channel) {
   adc.setCompareChannels(channel);
   // setCompareChannels_nonblock(channel);
   voltage = adc.getResult_V(); // alternative: getResult_mV for Millivolt
+  // int16_t result = adc.getRawResult_12bit(); // native 12 bit result: -2048...2047
   return voltage;
 }
@@ -0,0 +1,78 @@
+/***************************************************************************
+* Example sketch for the ADS1115_WE library
+*
+* This sketch shows how to capture continuous conversions into a ring buffer. 
+* The alert pin is used as conversion ready pin. The interrupt service routine 
+* only notifies the acquisition object, loop() reads the conversions with 
+* service() and takes them out of the buffer in blocks. Thanks to the buffer, 
+* loop() does not need to be on time for every single conversion.
+*  
+* Further information can be found on:
+* https://wolles-elektronikkiste.de/ads1115 (German)
+* https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+* 
+***************************************************************************/
+
+#include<ADS1115_WE.h> 
+#include<ADS1115_Acquisition.h>
+#include<Wire.h>
+#define I2C_ADDRESS 0x48
+int interruptPin = 2;
+
+ADS1115_WE adc = ADS1115_WE(I2C_ADDRESS);
+ADS1115_RingBuffer<64> buffer; // capacity must be a power of two
+ADS1115_Acquisition acquisition(adc, buffer);
+
+void setup() {
+  Wire.begin();
+  Wire.setClock(400000);
+  Serial.begin(115200);
+  pinMode(interruptPin, INPUT_PULLUP);
+  if(!adc.init()){
+    Serial.println("ADS1115 not connected!");
+  }
+  adc.setVoltageRange_mV(ADS1115_RANGE_6144);
+  adc.setCompareChannels(ADS1115_COMP_0_GND);
+  adc.setConvRate(ADS1115_860_SPS);
+
+  Serial.println("ADS1115 Example Sketch - Continuous Acquisition into a Ring Buffer");
+  Serial.println();
+  attachInterrupt(digitalPinToInterrupt(interruptPin), convReadyAlert, FALLING);
+  acquisition.begin(); // alert pin = conversion ready, continuous mode
+}
+
+void loop() {
+  static unsigned long lastOutput = 0;
+  static long sum = 0;
+  static unsigned int count = 0;
+  int16_t samples[16];
+
+  acquisition.service();
+  
+  uint16_t n = acquisition.read(samples, 16);
+  for(uint16_t i=0; i<n; i++){
+    sum += samples[i];
+    count++;
+  }
+
+  if(millis() - lastOutput > 1000){
+    lastOutput = millis();
+    if(count){
+      float voltage = (sum * 1.0 / count) * adc.getVoltageRange_mV() / ADS1115_WE::ADS1115_REG_FACTOR;
+      Serial.print("Samples/s: ");
+      Serial.print(count);
+      Serial.print(", mean voltage [mV]: ");
+      Serial.print(voltage);
+      Serial.print(", missed: ");
+      Serial.print(acquisition.getMissedConversions());
+      Serial.print(", overruns: ");
+      Serial.println(acquisition.getOverruns());
+    }
+    sum = 0;
+    count = 0;
+  }
+}
+
+void convReadyAlert(){
+  acquisition.onConversionReady();
+}
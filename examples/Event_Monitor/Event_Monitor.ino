@@ -0,0 +1,79 @@
+/***************************************************************************
+* Example sketch for the ADS1115_WE library
+*
+* This sketch shows how the comparator of the ADS1115 watches two channels
+* while the microcontroller waits (sleeps on AVR boards) for the alert:
+*  - AIN0: alert above 2.0 volts (max limit)
+*  - AIN3: alert outside the window 1.0 to 4.0 volts
+* The ADS1115 measures each channel for four conversions, then the monitor
+* arms the other channel. Apart from that, there is only bus traffic when a
+* limit is exceeded. The limits are calculated at compile time.
+* Connect the ALERT pin to the interrupt pin (2).
+*
+* Further information can be found on:
+* https://wolles-elektronikkiste.de/ads1115 (German)
+* https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+*
+***************************************************************************/
+
+#include<ADS1115_WE.h>
+#include<ADS1115_EventMonitor.h>
+#include<Wire.h>
+#define I2C_ADDRESS 0x48
+int interruptPin = 2;
+
+ADS1115_WE adc = ADS1115_WE(I2C_ADDRESS);
+ADS1115_EventMonitor monitor(adc);
+
+const ADS1115_EventChannel channels[] = {
+  {ADS1115_COMP_0_GND, ADS1115_RANGE_4096, ADS1115_MAX_LIMIT,
+   ADS1115_WE::millivoltsToRaw(ADS1115_RANGE_4096, 2000), ADS1115_WE::millivoltsToRaw(ADS1115_RANGE_4096, 1900)},
+  {ADS1115_COMP_3_GND, ADS1115_RANGE_6144, ADS1115_WINDOW,
+   ADS1115_WE::millivoltsToRaw(ADS1115_RANGE_6144, 4000), ADS1115_WE::millivoltsToRaw(ADS1115_RANGE_6144, 1000)}
+};
+
+void alertISR(){
+  monitor.notifyAlert();
+}
+
+void setup() {
+  Wire.begin();
+  Serial.begin(115200);
+  pinMode(interruptPin, INPUT_PULLUP);
+  if(!adc.init()){
+    Serial.println("ADS1115 not connected!");
+  }
+  adc.setConvRate(ADS1115_32_SPS);
+  adc.setAlertPol(ADS1115_ACT_LOW);
+  adc.setWaitStrategy(ADS1115_WAIT_INTERRUPT);
+  attachInterrupt(digitalPinToInterrupt(interruptPin), alertISR, FALLING);
+
+  /* 4 conversions per channel, alert after 1 conversion beyond the limits */
+  if(!monitor.begin(channels, 2, 4, ADS1115_ASSERT_AFTER_1)){
+    Serial.println("Invalid channel list!");
+  }
+
+  Serial.println("ADS1115 Example Sketch - Event Monitor");
+  Serial.println();
+}
+
+void loop() {
+  ADS1115_Event event;
+  if(monitor.waitForEvent(event, 1000)){
+    const ADS1115_EventChannel &channel = channels[event.entry];
+    float voltage = event.sample.raw * (ADS1115_WE::rangeToMillivolts(channel.range) / 32768.0);
+    Serial.print("Alert on entry ");
+    Serial.print(event.entry);
+    Serial.print(": ");
+    Serial.print(voltage);
+    Serial.print(" mV at ");
+    Serial.print(event.time / 1000);
+    Serial.println(" ms");
+  }
+  else{
+    Serial.print("No event for a second. Alerts: ");
+    Serial.print(monitor.getAlerts());
+    Serial.print(", channel changes: ");
+    Serial.println(monitor.getRotations());
+  }
+}
@@ -0,0 +1,67 @@
+/***************************************************************************
+* Example sketch for the ADS1115_WE library
+*
+* This sketch shows how to filter oversampled results with integer filters. 
+* The ADS1115 converts continuously at 860 SPS into a ring buffer (see the 
+* example Continuous_Acquisition.ino). The filter takes the results out of 
+* the buffer and
+*   1) removes spikes with a running median of 3 results
+*   2) averages 16 results (-> 53.75 results per second)
+*   3) smoothes the averages with an exponential moving average (alpha = 1/4)
+* Each of these stages can be switched off, see ADS1115_Filter.h. 
+*  
+* Further information can be found on:
+* https://wolles-elektronikkiste.de/ads1115 (German)
+* https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+* 
+***************************************************************************/
+
+#include<ADS1115_WE.h> 
+#include<ADS1115_Acquisition.h>
+#include<ADS1115_Filter.h>
+#include<Wire.h>
+#define I2C_ADDRESS 0x48
+int interruptPin = 2;
+
+ADS1115_WE adc = ADS1115_WE(I2C_ADDRESS);
+ADS1115_RingBuffer<64> buffer; // capacity must be a power of two
+ADS1115_Acquisition acquisition(adc, buffer);
+
+/* ADS1115_Filter<median length, decimation factor, EMA shift> */
+ADS1115_Filter<3, 16, 2> filter;
+
+void setup() {
+  Wire.begin();
+  Wire.setClock(400000);
+  Serial.begin(115200);
+  pinMode(interruptPin, INPUT_PULLUP);
+  if(!adc.init()){
+    Serial.println("ADS1115 not connected!");
+  }
+  adc.setVoltageRange_mV(ADS1115_RANGE_6144); // the range must not change while filtering
+  adc.setCompareChannels(ADS1115_COMP_3_GND);
+  adc.setConvRate(ADS1115_860_SPS);
+
+  Serial.println("ADS1115 Example Sketch - Filtered Acquisition");
+  Serial.println();
+  attachInterrupt(digitalPinToInterrupt(interruptPin), convReadyAlert, FALLING);
+  acquisition.begin();
+}
+
+void loop() {
+  static unsigned long lastOutput = 0;
+  
+  acquisition.service();
+  filter.process(buffer); // returns the number of new filter outputs
+
+  if(millis() - lastOutput > 500){
+    lastOutput = millis();
+    float voltage = filter.read() * (adc.getVoltageRange_mV() / 32768.0);
+    Serial.print("Filtered voltage [mV]: ");
+    Serial.println(voltage);
+  }
+}
+
+void convReadyAlert(){
+  acquisition.onConversionReady();
+}
@@ -0,0 +1,65 @@
+/***************************************************************************
+* Example sketch for the ADS1115_WE library
+*
+* This sketch shows how to use ADS1x15<>, a variant of ADS1115_WE for setups 
+* where chip, I2C address, voltage range and conversion rate never change. 
+* Config words, conversion time and scaling are calculated at compile time, 
+* so each single shot measurement needs only one config register write and 
+* the results are converted with integer arithmetic. 
+*  
+* Further information can be found on:
+* https://wolles-elektronikkiste.de/ads1115 (German)
+* https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+* 
+***************************************************************************/
+
+#include<ADS1x15.h> 
+#include<Wire.h>
+
+/* Template parameters:
+ * chip:                ADS1115_CHIP or ADS1015_CHIP
+ * I2C address:         0x48 ... 0x4B
+ * voltage range:       ADS1115_RANGE_6144 ... ADS1115_RANGE_0256
+ * conversion rate:     ADS1115_8_SPS ... ADS1115_860_SPS
+ */
+ADS1x15<ADS1115_CHIP, 0x48, ADS1115_RANGE_6144, ADS1115_128_SPS> adc;
+
+void setup() {
+  Wire.begin();
+  Serial.begin(115200);
+  if(!adc.init()){
+    Serial.println("ADS1115 not connected!");
+  }
+  Serial.print("Voltage range [mV]: ");
+  Serial.println(adc.VOLTAGE_RANGE_MV);
+  Serial.print("Conversion time [µs]: ");
+  Serial.println(adc.CONV_TIME_US);
+  Serial.println("ADS1115 Example Sketch - Fixed Configuration");
+  Serial.println();
+}
+
+void loop() {
+  int16_t raw = 0;
+  
+  Serial.print("0: ");
+  raw = adc.readSingle<ADS1115_COMP_0_GND>();
+  Serial.print(adc.rawToMillivolts(raw));
+  Serial.print(" mV,   ");
+
+  Serial.print("1: ");
+  raw = adc.readSingle<ADS1115_COMP_1_GND>();
+  Serial.print(adc.rawToMillivolts(raw));
+  Serial.print(" mV,   ");
+
+  Serial.print("2: ");
+  raw = adc.readSingle<ADS1115_COMP_2_GND>();
+  Serial.print(adc.rawToMillivolts(raw));
+  Serial.print(" mV,   ");
+
+  Serial.print("3: ");
+  raw = adc.readSingle<ADS1115_COMP_3_GND>();
+  Serial.print(adc.rawToMicrovolts(raw));
+  Serial.println(" µV");
+
+  delay(1000);
+}
@@ -0,0 +1,67 @@
+/***************************************************************************
+* Example sketch for the ADS1115_WE library
+*
+* This sketch shows how to measure 16 single ended channels with four ADS1115
+* modules using ADS1115_Array. The address pins have to be connected to:
+* 
+* GND -> 0x48 (or leave unconnected)
+* VCC -> 0x49
+* SDA -> 0x4A
+* SCL -> 0x4B
+* 
+* All four ADS1115 convert at the same time. Whenever one of them is ready, its
+* result is read and its next channel is started. So a frame of 16 values takes
+* about as long as 4 conversions of one ADS1115 - as long as the I2C bus is 
+* fast enough (use 400 kHz). 
+*  
+* Further information can be found on:
+* https://wolles-elektronikkiste.de/ads1115 (German)
+* https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+* 
+***************************************************************************/
+
+#include<ADS1115_WE.h> 
+#include<ADS1115_Array.h>
+#include<Wire.h>
+
+ADS1115_WE adc_1 = ADS1115_WE(0x48);
+ADS1115_WE adc_2 = ADS1115_WE(0x49);
+ADS1115_WE adc_3 = ADS1115_WE(0x4A);
+ADS1115_WE adc_4 = ADS1115_WE(0x4B);
+ADS1115_Array adcArray;
+
+void setup() {
+  Wire.begin();
+  Wire.setClock(400000);
+  Serial.begin(115200);
+  
+  ADS1115_WE *adcs[4] = {&adc_1, &adc_2, &adc_3, &adc_4};
+  for(int i=0; i<4; i++){
+    if(!adcs[i]->init()){
+      Serial.print("ADS1115 No ");
+      Serial.print(i + 1);
+      Serial.println(" not connected!");
+    }
+    adcs[i]->setVoltageRange_mV(ADS1115_RANGE_6144);
+    adcs[i]->setConvRate(ADS1115_128_SPS);
+    adcArray.addDevice(*adcs[i]);
+  }
+
+  /* channels 0 to 3 vs. GND of each ADS1115 */ 
+  adcArray.begin(4);
+  Serial.println("ADS1115 Example Sketch - Four ADS1115 as array");
+  Serial.println();
+}
+
+void loop() {
+  /* update() does not block - you can do other things in between */
+  if(adcArray.update()){
+    /* entry = device index * 4 + channel */
+    for(int i=0; i<adcArray.getFrameSize(); i++){
+      Serial.print(adcArray.getResult_mV(i), 0);
+      Serial.print((i % 4 == 3) ? "\n" : "\t");
+    }
+    Serial.println("-------------------------------");
+    delay(1000);
+  }
+}
@@ -0,0 +1,61 @@
+/***************************************************************************
+* Example sketch for the ADS1115_WE library
+*
+* This sketch shows how to measure several channels without blocking code. 
+* The scanner switches the channels and starts the conversions in single shot 
+* mode. update() only takes action if a conversion is finished, so loop() can 
+* do other things in the meantime. Here, the loop counter shows how often 
+* loop() runs per scan.
+*  
+* Further information can be found on:
+* https://wolles-elektronikkiste.de/ads1115 (German)
+* https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+* 
+***************************************************************************/
+
+#include<ADS1115_WE.h> 
+#include<ADS1115_Scanner.h>
+#include<Wire.h>
+#define I2C_ADDRESS 0x48
+
+ADS1115_WE adc = ADS1115_WE(I2C_ADDRESS);
+ADS1115_Scanner scanner(adc);
+
+const ADS1115_MUX scanList[] = {ADS1115_COMP_0_GND, ADS1115_COMP_1_GND, ADS1115_COMP_2_GND, ADS1115_COMP_3_GND};
+
+void setup() {
+  Wire.begin();
+  Serial.begin(115200);
+  if(!adc.init()){
+    Serial.println("ADS1115 not connected!");
+  }
+  adc.setVoltageRange_mV(ADS1115_RANGE_6144);
+  adc.setConvRate(ADS1115_8_SPS);
+
+  Serial.println("ADS1115 Example Sketch - Non-blocking Multi Channel Scanner");
+  Serial.println();
+  scanner.begin(scanList, 4); // polls the conversion state; begin(scanList, 4, true) uses the alert pin
+}
+
+void loop() {
+  static unsigned long loopCounter = 0;
+  loopCounter++;
+
+  if(scanner.update()){ // true if all four channels have been measured
+    Serial.print("Scan No ");
+    Serial.print(scanner.getScanCount());
+    Serial.print(" (loops: ");
+    Serial.print(loopCounter);
+    Serial.println(")");
+    for(uint8_t i=0; i<4; i++){
+      Serial.print("Channel ");
+      Serial.print(i);
+      Serial.print(" [V]: ");
+      Serial.println(scanner.getResult_V(i));
+    }
+    Serial.println("-------------------------------");
+    loopCounter = 0;
+  }
+  
+  /* do other things here */
+}
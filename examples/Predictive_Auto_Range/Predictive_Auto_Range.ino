@@ -0,0 +1,56 @@
+/***************************************************************************
+* Example sketch for the ADS1115_WE library
+*
+* This sketch shows how to use the predictive auto range in continuous mode. 
+* Unlike setAutoRange() and setPermanentAutoRangeMode(), it never blocks: 
+* getSample() calculates the best range from the last result and switches 
+* directly to it. Each result is tagged with the range it was measured in. 
+* This way auto range works at 860 SPS and with fast changing voltages. 
+*  
+* Further information can be found on:
+* https://wolles-elektronikkiste.de/ads1115 (German)
+* https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+* 
+***************************************************************************/
+
+#include<ADS1115_WE.h> 
+#include<Wire.h>
+#define I2C_ADDRESS 0x48
+
+ADS1115_WE adc = ADS1115_WE(I2C_ADDRESS);
+
+void setup() {
+  Wire.begin();
+  Serial.begin(115200);
+  if(!adc.init()){
+    Serial.println("ADS1115 not connected!");
+  }
+  adc.setCompareChannels(ADS1115_COMP_3_GND);
+  adc.setConvRate(ADS1115_860_SPS);
+
+  /* A new range is chosen if the result is below 40% or above 90% of the 
+   * full scale (default). You can change these thresholds:
+   */
+  //adc.setAutoRangeThresholds(30, 80);
+  adc.setPredictiveAutoRange(true);
+  adc.setMeasureMode(ADS1115_CONTINUOUS);
+  Serial.println("ADS1115 Example Sketch - Predictive Auto Range");
+  Serial.println();
+}
+
+void loop() {
+  ADS1115_Sample sample;
+
+  /* getSample() returns false for a short time after a range change, until the 
+   * first result in the new range is available.
+   */
+  if(adc.getSample(sample)){
+    unsigned int range = ADS1115_WE::rangeToMillivolts(sample.range);
+    float voltage = sample.raw * (range / 32768.0);
+    Serial.print("Range: +/- ");
+    Serial.print(range);
+    Serial.print(" mV, Voltage [mV]: ");
+    Serial.println(voltage);
+  }
+  delay(100);
+}
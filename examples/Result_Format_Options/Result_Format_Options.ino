@@ -49,6 +49,17 @@ void loop() {
   Serial.print("Result in Volt                [V]: ");
   Serial.println(voltageInVolt);
 
+  /* Integer output without floating point arithmetic (saves flash and time on 
+   * AVR based boards): microvolts or millivolts as Q16.16 fixed point number 
+   */
+  long voltageInMicrovolt = adc.getResult_uV(); 
+  Serial.print("Result in Microvolt          [µV]: ");
+  Serial.println(voltageInMicrovolt);
+
+  long voltageInMillivoltQ16 = adc.getResult_mV_fixed(); 
+  Serial.print("Result in Millivolt, rounded [mV]: ");
+  Serial.println((voltageInMillivoltQ16 + 32768) >> 16);
+
   /* Get the raw result from the conversion register. The conversion register 
    * contains the conversion result of the amplified (!) voltage. This means the
    * value depends on the voltage as well as on the voltage range. E.g. if the 
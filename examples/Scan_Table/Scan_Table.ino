@@ -0,0 +1,80 @@
+/***************************************************************************
+* Example sketch for the ADS1115_WE library
+*
+* This sketch shows how to measure channels which need different settings,
+* e.g. a differential pair in a small range and single-ended channels in a
+* large range. Each entry of the scan table contains channel, range and rate.
+* The config words are calculated at compile time, so switching to the next
+* entry and starting the conversion is one register write.
+*
+* The table works with the blocking functions (startSingleMeasurement(entry)
+* and waitForConversion(), or setScanEntry() in continuous mode) as well as
+* with the non-blocking ADS1115_Scanner. Choose with useScanner.
+*
+* Further information can be found on:
+* https://wolles-elektronikkiste.de/ads1115 (German)
+* https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+*
+***************************************************************************/
+
+#include<ADS1115_WE.h>
+#include<ADS1115_Scanner.h>
+#include<Wire.h>
+#define I2C_ADDRESS 0x48
+
+ADS1115_WE adc = ADS1115_WE(I2C_ADDRESS);
+ADS1115_Scanner scanner(adc);
+const bool useScanner = false;
+
+const ADS1115_ScanEntry scanTable[] = {
+  {ADS1115_COMP_0_1,   ADS1115_RANGE_2048, ADS1115_128_SPS}, // differential
+  {ADS1115_COMP_2_GND, ADS1115_RANGE_4096, ADS1115_860_SPS},
+  {ADS1115_COMP_3_GND, ADS1115_RANGE_6144, ADS1115_250_SPS}
+};
+const uint8_t entries = sizeof(scanTable) / sizeof(scanTable[0]);
+
+void setup() {
+  Wire.begin();
+  Serial.begin(115200);
+  if(!adc.init()){
+    Serial.println("ADS1115 not connected!");
+  }
+  adc.setMeasureMode(ADS1115_SINGLE);
+
+  Serial.println("ADS1115 Example Sketch - Scan Table");
+  Serial.println();
+  if(useScanner){
+    scanner.begin(scanTable, entries);
+  }
+}
+
+void loop() {
+  float results[entries];
+  if(useScanner){
+    if(!scanner.update()){
+      return; // do other things here
+    }
+    for(uint8_t i=0; i<entries; i++){
+      results[i] = scanner.getResult_mV(i);
+    }
+  }
+  else{
+    for(uint8_t i=0; i<entries; i++){
+      adc.startSingleMeasurement(scanTable[i]);
+      adc.waitForConversion();
+      results[i] = adc.getResult_mV();
+    }
+  }
+  for(uint8_t i=0; i<entries; i++){
+    Serial.print("Entry ");
+    Serial.print(i);
+    Serial.print(" (+/-");
+    Serial.print(ADS1115_WE::rangeToMillivolts(scanTable[i].range()));
+    Serial.print(" mV) [mV]: ");
+    Serial.println(results[i]);
+  }
+  Serial.println("-------------------------------");
+  if(!useScanner){
+    delay(1000);
+  }
+}
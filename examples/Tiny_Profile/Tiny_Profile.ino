@@ -0,0 +1,59 @@
+/***************************************************************************
+* Example sketch for the ADS1115_WE library
+*
+* This sketch shows how to measure with the tiny profile for small MCUs like
+* the ATtiny85 (8 KB flash, 512 bytes RAM). The tiny profile removes auto range,
+* the range memory per channel, the statistics, all float functions, the wait
+* strategies, Hs-mode, the bus lock and the calibration. The results are read
+* as integers (microvolts), so no float math is linked.
+*
+* !!!! UNCOMMENT #define ADS1115_TINY IN ADS1115_config.h (libraries/ADS1115_WE/src)
+* !!!! OR ADD -DADS1115_TINY TO THE BUILD FLAGS (e.g. PlatformIO: build_flags)
+*
+* On an ATtiny85 you also need to uncomment #define USE_TINY_WIRE_M_ and a core
+* with Serial (e.g. ATTinyCore, TX on PB0) or another output. The sizes of all
+* example sketches with and without tiny profile: extras/size_report.sh
+*
+* Further information can be found on:
+* https://wolles-elektronikkiste.de/ads1115 (German)
+* https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+*
+***************************************************************************/
+
+#include<ADS1115_WE.h> // first, USE_TINY_WIRE_M_ is defined in ADS1115_config.h
+#ifdef USE_TINY_WIRE_M_
+#include <TinyWireM.h>
+#else
+#include<Wire.h>
+#endif
+#define I2C_ADDRESS 0x48
+
+ADS1115_WE adc = ADS1115_WE(I2C_ADDRESS);
+
+void setup() {
+#ifdef USE_TINY_WIRE_M_
+  TinyWireM.begin();
+#else
+  Wire.begin();
+#endif
+  Serial.begin(9600);
+  if(!adc.init()){
+    Serial.println("ADS1115 not connected!");
+  }
+  adc.setVoltageRange_mV(ADS1115_RANGE_6144);
+}
+
+void loop() {
+  for(uint8_t channel=0; channel<4; channel++){
+    adc.setSingleChannel(channel);
+    adc.startSingleMeasurement();
+    adc.waitForConversion();
+    int32_t microvolts = adc.getResult_uV();
+    Serial.print("Channel ");
+    Serial.print(channel);
+    Serial.print(" [mV]: ");
+    Serial.println((microvolts + 500) / 1000);
+  }
+  Serial.println("-------------------------------");
+  delay(1000);
+}
@@ -0,0 +1,76 @@
+/***************************************************************************
+* Example sketch for the ADS1115_WE library
+*
+* This sketch shows how to choose the way the library waits for conversions.
+* Every poll of the OS bit (isBusy()) is a complete I2C read of the config 
+* register. With the ALERT/RDY pin as conversion ready signal, the library 
+* can wait without any bus traffic: 
+*
+* ADS1115_WAIT_POLL_OS      -> polls the OS bit (default), see setPollBackoff()
+* ADS1115_WAIT_POLL_RDY_PIN -> polls the ALERT/RDY pin with digitalRead()
+* ADS1115_WAIT_INTERRUPT    -> waits for the interrupt of the ALERT/RDY pin
+* ADS1115_WAIT_TIMED        -> waits the maximum conversion time
+*
+* The strategy is used by waitForConversion() and inside the library, e.g. 
+* by setCompareChannels() in continuous mode. 
+*  
+* Further information can be found on:
+* https://wolles-elektronikkiste.de/ads1115 (German)
+* https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+* 
+***************************************************************************/
+
+#include<ADS1115_WE.h> 
+#include<Wire.h>
+#define I2C_ADDRESS 0x48
+int interruptPin = 2;
+
+ADS1115_WE adc = ADS1115_WE(I2C_ADDRESS);
+
+void convReadyAlert(){
+  adc.notifyConversionReady();
+}
+
+void setup() {
+  Wire.begin();
+  Serial.begin(115200);
+  pinMode(interruptPin, INPUT_PULLUP);
+  if(!adc.init()){
+    Serial.println("ADS1115 not connected!");
+  }
+  adc.setVoltageRange_mV(ADS1115_RANGE_6144);
+  adc.setConvRate(ADS1115_128_SPS);
+  
+  /* the ALERT/RDY pin as conversion ready pin */
+  adc.setAlertPinMode(ADS1115_ASSERT_AFTER_1);
+  adc.setAlertPinToConversionReady();
+  adc.setReadyPin(interruptPin); // needed for ADS1115_WAIT_POLL_RDY_PIN
+  attachInterrupt(digitalPinToInterrupt(interruptPin), convReadyAlert, FALLING);
+  
+  /* choose one */
+  adc.setWaitStrategy(ADS1115_WAIT_INTERRUPT);
+  // adc.setWaitStrategy(ADS1115_WAIT_POLL_RDY_PIN);
+  // adc.setWaitStrategy(ADS1115_WAIT_TIMED);
+  // adc.setWaitStrategy(ADS1115_WAIT_POLL_OS);
+  // adc.setPollBackoff(50, 400); // ADS1115_WAIT_POLL_OS: first poll interval 50 µs, doubled up to 400 µs
+  
+  /* optional: the waits are based on the measured instead of the maximum conversion time */
+  // adc.calibrateConvRate();
+  
+  Serial.println("ADS1115 Example Sketch - Wait Strategy");
+  Serial.println();
+}
+
+void loop() {
+  for(int channel=0; channel<4; channel++){
+    adc.startSingleMeasurement(static_cast<ADS1115_MUX>(ADS1115_COMP_0_GND + ADS1115_COMP_INC * channel));
+    adc.waitForConversion();
+    Serial.print("Channel ");
+    Serial.print(channel);
+    Serial.print(": ");
+    Serial.print(adc.getResult_V());
+    Serial.println(" V");
+  }
+  Serial.println("-------------------------------");
+  delay(1000);
+}
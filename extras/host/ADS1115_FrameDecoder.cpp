@@ -0,0 +1,135 @@
+#include "ADS1115_FrameDecoder.h"
+
+namespace
+{
+    const uint8_t FRAME_SYNC = 0xA5;
+    const uint8_t FRAME_VERSION = 1;
+    const uint8_t FRAME_DELTA = 0x01;
+    const uint8_t FRAME_ABSOLUTE = 0x02;
+
+    /* returns false if the data ends before the varint */
+    bool readVarint(const std::vector<uint8_t> &in, size_t &pos, uint32_t &val){
+        val = 0;
+        for(uint8_t shift=0; shift<35; shift+=7){
+            if(pos >= in.size()){
+                return false;
+            }
+            uint8_t b = in[pos++];
+            val |= uint32_t(b & 0x7F) << shift;
+            if(!(b & 0x80)){
+                return true;
+            }
+        }
+        return true; // too long, the CRC check fails
+    }
+}
+
+void ADS1115_FrameDecoder::feed(const uint8_t *data, size_t len){
+    input.insert(input.end(), data, data + len);
+}
+
+bool ADS1115_FrameDecoder::next(ADS1115_Frame &frame){
+    while(!input.empty()){
+        if(input[0] != FRAME_SYNC){
+            input.erase(input.begin());
+            skippedBytes++;
+            timeValid = false; // a frame was lost, wait for the next absolute timestamp
+            continue;
+        }
+        size_t frameLen = 0;
+        ParseResult result = parse(frame, frameLen);
+        if(result == PARSE_INCOMPLETE){
+            return false;
+        }
+        if(result == PARSE_INVALID){
+            /* the sync byte may be part of the samples, search again behind it */
+            input.erase(input.begin());
+            skippedBytes++;
+            timeValid = false;
+            continue;
+        }
+        input.erase(input.begin(), input.begin() + frameLen);
+        frames++;
+        return true;
+    }
+    return false;
+}
+
+ADS1115_FrameDecoder::ParseResult ADS1115_FrameDecoder::parse(ADS1115_Frame &frame, size_t &frameLen){
+    if(input.size() < 6){
+        return PARSE_INCOMPLETE;
+    }
+    uint8_t flags = input[1];
+    uint8_t channels = input[2];
+    uint8_t sets = input[3];
+    if(((flags >> 4) != FRAME_VERSION) || (channels == 0) || (channels > 8) || (sets == 0)){
+        return PARSE_INVALID;
+    }
+    size_t pos = 6;
+    if(input.size() < pos + channels){
+        return PARSE_INCOMPLETE;
+    }
+    std::vector<uint8_t> sources(input.begin() + pos, input.begin() + pos + channels);
+    pos += channels;
+    uint32_t time;
+    if(!readVarint(input, pos, time)){
+        return PARSE_INCOMPLETE;
+    }
+    std::vector<int16_t> samples(size_t(sets) * channels);
+    if(flags & FRAME_DELTA){
+        int16_t previous[8] = {0};
+        for(size_t i=0; i<samples.size(); i++){
+            uint32_t zigZag;
+            if(!readVarint(input, pos, zigZag)){
+                return PARSE_INCOMPLETE;
+            }
+            int32_t diff = int32_t(zigZag >> 1) ^ -int32_t(zigZag & 1);
+            previous[i % channels] = int16_t(previous[i % channels] + diff);
+            samples[i] = previous[i % channels];
+        }
+    }
+    else{
+        if(input.size() < pos + 2 * samples.size()){
+            return PARSE_INCOMPLETE;
+        }
+        for(size_t i=0; i<samples.size(); i++){
+            samples[i] = int16_t(input[pos] | (input[pos + 1] << 8));
+            pos += 2;
+        }
+    }
+    if(input.size() < pos + 1){
+        return PARSE_INCOMPLETE;
+    }
+    if(crc8(&input[1], pos - 1) != input[pos]){
+        crcErrors++;
+        return PARSE_INVALID;
+    }
+    frameLen = pos + 1;
+
+    if(flags & FRAME_ABSOLUTE){
+        lastTimestamp = time;
+        timeValid = true;
+    }
+    else{
+        lastTimestamp += time;
+    }
+    frame.flags = flags;
+    frame.sources = sources;
+    frame.sets = sets;
+    frame.interval_us = input[4] | (input[5] << 8);
+    frame.timestamp_us = lastTimestamp;
+    frame.timeValid = timeValid;
+    frame.samples = samples;
+    return PARSE_OK;
+}
+
+uint8_t ADS1115_FrameDecoder::crc8(const uint8_t *data, size_t len){
+    uint8_t crc = 0;
+    for(size_t i=0; i<len; i++){
+        crc ^= data[i];
+        for(uint8_t bit=0; bit<8; bit++){
+            crc = (crc & 0x80) ? ((crc << 1) ^ 0x07) : (crc << 1);
+        }
+    }
+    return crc;
+}
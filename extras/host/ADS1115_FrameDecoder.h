@@ -0,0 +1,57 @@
+/******************************************************************************
+ *
+ * Host side decoder for the frames of ADS1115_FrameEncoder (format: see
+ * src/ADS1115_FrameEncoder.h). Bytes can be fed in pieces of any size, e.g. as
+ * they come from a serial port. Frames with a wrong CRC or an unknown version
+ * are skipped and the decoder searches the next sync byte.
+ *
+ ******************************************************************************/
+
+#ifndef ADS1115_FRAME_DECODER_H_
+#define ADS1115_FRAME_DECODER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+struct ADS1115_Frame {
+    uint8_t flags = 0;
+    std::vector<uint8_t> sources;   // one source byte per channel
+    uint8_t sets = 0;
+    uint16_t interval_us = 0;       // between two sets, 0 = unknown
+    uint32_t timestamp_us = 0;      // first set, only valid if timeValid
+    bool timeValid = false;         // false until the first absolute timestamp
+    std::vector<int16_t> samples;   // sets * channels, interleaved
+
+    uint8_t channels() const { return sources.size(); }
+    int16_t sample(uint8_t set, uint8_t channel) const { return samples[set * channels() + channel]; }
+    static uint8_t mux(uint8_t source) { return source & 7; }         // ADS1115_MUX >> 12
+    static uint8_t range(uint8_t source) { return (source >> 3) & 7; } // ADS1115_RANGE >> 9
+    static uint8_t device(uint8_t source) { return source >> 6; }
+};
+
+class ADS1115_FrameDecoder
+{
+    public:
+        void feed(const uint8_t *data, size_t len);
+
+        /* returns true and fills frame if a complete frame was received */
+        bool next(ADS1115_Frame &frame);
+
+        uint32_t getFrames() const { return frames; }
+        uint32_t getCrcErrors() const { return crcErrors; }
+        uint32_t getSkippedBytes() const { return skippedBytes; }
+
+    private:
+        enum ParseResult {PARSE_OK, PARSE_INCOMPLETE, PARSE_INVALID};
+        std::vector<uint8_t> input;
+        bool timeValid = false;
+        uint32_t lastTimestamp = 0;
+        uint32_t frames = 0;
+        uint32_t crcErrors = 0;
+        uint32_t skippedBytes = 0;
+        ParseResult parse(ADS1115_Frame &frame, size_t &frameLen);
+        static uint8_t crc8(const uint8_t *data, size_t len);
+};
+
+#endif
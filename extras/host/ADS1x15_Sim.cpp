@@ -0,0 +1,316 @@
+/******************************************************************************
+ *
+ * Register level simulation of the ADS1115 and the ADS1015 for host builds.
+ *
+ ******************************************************************************/
+
+#include "ADS1x15_Sim.h"
+
+namespace
+{
+    const uint16_t ads1115Rates[8] = {8, 16, 32, 64, 128, 250, 475, 860};
+    const uint16_t ads1015Rates[8] = {128, 250, 490, 920, 1600, 2400, 3300, 3300};
+    const double fullScale[8] = {6.144, 4.096, 2.048, 1.024, 0.512, 0.256, 0.256, 0.256};
+    /* positive and negative input per mux setting, -1 = GND */
+    const int8_t muxInputs[8][2] = {{0, 1}, {0, 3}, {1, 3}, {2, 3}, {0, -1}, {1, -1}, {2, -1}, {3, -1}};
+}
+
+ADS1x15_Sim::ADS1x15_Sim(simChip c, uint8_t addr) : chip{c}, address{addr}, rng{1} {
+    for(Waveform &in : inputs){
+        in = [](double) { return 0.0; };
+    }
+}
+
+ADS1x15_Sim::~ADS1x15_Sim(){
+    disconnect();
+}
+
+void ADS1x15_Sim::connect(TwoWire &b){
+    bus = &b;
+    bus->attachDevice(this);
+    ArduinoHost::addEventSource(this);
+}
+
+void ADS1x15_Sim::disconnect(){
+    if(bus){
+        bus->detachDevice(this);
+        bus = nullptr;
+    }
+    ArduinoHost::removeEventSource(this);
+}
+
+void ADS1x15_Sim::setAlertPin(uint8_t pin){
+    alertPin = pin;
+    updateAlertPin();
+}
+
+void ADS1x15_Sim::setInput(uint8_t ain, Waveform volts){
+    if(ain < 4){
+        inputs[ain] = volts;
+    }
+}
+
+void ADS1x15_Sim::setInputVoltage(uint8_t ain, double volts){
+    setInput(ain, [volts](double) { return volts; });
+}
+
+ADS1x15_Sim::Waveform ADS1x15_Sim::sine(double amplitude, double frequency, double offset){
+    return [=](double t) { return offset + amplitude * sin(2.0 * M_PI * frequency * t); };
+}
+
+void ADS1x15_Sim::setOscillatorError(double relError){
+    oscError = relError;
+}
+
+void ADS1x15_Sim::setNoise(double lsbRms, uint32_t seed){
+    noiseLsb = lsbRms;
+    rng.seed(seed);
+}
+
+void ADS1x15_Sim::powerCycle(){
+    pointer = 0;
+    config = 0x0583;
+    conversion = 0;
+    loThresh = 0x8000;
+    hiThresh = 0x7FFF;
+    converting = false;
+    readyAsserted = false;
+    pulseEndNs = UINT64_MAX;
+    compAsserted = false;
+    compCount = 0;
+    newResult = false;
+    updateAlertPin();
+}
+
+uint16_t ADS1x15_Sim::getRegister(uint8_t reg){
+    switch(reg & 3){
+        case 0:
+            return conversion;
+        case 1:
+            /* OS bit: 0 = conversion in progress (single shot); always 1 in continuous mode */
+            if((config & 0x0100) && converting){
+                return config;
+            }
+            return config | 0x8000;
+        case 2:
+            return loThresh;
+        default:
+            return hiThresh;
+    }
+}
+
+bool ADS1x15_Sim::alertAsserted(){
+    if((config & 3) == 3){
+        return false;
+    }
+    return readyMode() ? readyAsserted : compAsserted;
+}
+
+uint32_t ADS1x15_Sim::conversionPeriodNs(uint16_t conf){
+    uint8_t dr = (conf >> 5) & 7;
+    double sps = (chip == SIM_ADS1115) ? ads1115Rates[dr] : ads1015Rates[dr];
+    return static_cast<uint32_t>(1e9 / (sps * (1.0 + oscError)));
+}
+
+/* I2CDevice */
+
+bool ADS1x15_Sim::respondsTo(uint8_t addr){
+    return addr == address;
+}
+
+bool ADS1x15_Sim::write(const uint8_t *data, size_t len){
+    if(len == 0){ // address check only
+        return true;
+    }
+    simStats.pointerWrites++;
+    pointer = data[0] & 3;
+    if(len >= 3){
+        uint16_t val = (data[1] << 8) | data[2];
+        simStats.registerWrites++;
+        switch(pointer){
+            case 0: // conversion register is read only
+                break;
+            case 1:
+                writeConfig(val);
+                break;
+            case 2:
+                loThresh = val;
+                updateAlertPin();
+                break;
+            case 3:
+                hiThresh = val;
+                updateAlertPin();
+                break;
+        }
+    }
+    return true;
+}
+
+void ADS1x15_Sim::read(uint8_t *data, size_t len){
+    uint16_t val = getRegister(pointer);
+    simStats.registerReads++;
+    if(pointer == 0){
+        simStats.conversionReads++;
+        if(!newResult){
+            simStats.staleReads++;
+        }
+        newResult = false;
+        /* reading the conversion register clears a latched alert */
+        if((config & 0x0004) && compAsserted && !readyMode()){
+            compAsserted = false;
+            compCount = 0;
+            updateAlertPin();
+        }
+    }
+    for(size_t i=0; i<len; i++){
+        data[i] = (i % 2) ? (val & 0xFF) : (val >> 8);
+    }
+}
+
+void ADS1x15_Sim::generalCall(const uint8_t *data, size_t len){
+    if((len >= 1) && (data[0] == 0x06)){
+        powerCycle();
+    }
+}
+
+/* ArduinoHost::EventSource */
+
+uint64_t ADS1x15_Sim::nextEventNs(){
+    uint64_t next = converting ? convEndNs : UINT64_MAX;
+    return (pulseEndNs < next) ? pulseEndNs : next;
+}
+
+void ADS1x15_Sim::processEvents(uint64_t nowNs){
+    while(converting && (convEndNs <= nowNs)){
+        completeConversion();
+    }
+    if(pulseEndNs <= nowNs){
+        pulseEndNs = UINT64_MAX;
+        readyAsserted = false;
+        updateAlertPin();
+    }
+}
+
+/************************************************
+    private functions
+*************************************************/
+
+void ADS1x15_Sim::writeConfig(uint16_t val){
+    bool startRequest = val & 0x8000;
+    config = val & 0x7FFF;
+    if(!converting){
+        bool singleShot = config & 0x0100;
+        if(!singleShot || startRequest){
+            startConversion(ArduinoHost::nowNs());
+        }
+    }
+    /* a running conversion is completed with the settings it was started with */
+    updateAlertPin();
+}
+
+void ADS1x15_Sim::startConversion(uint64_t startNs){
+    converting = true;
+    convConfig = config;
+    convEndNs = startNs + conversionPeriodNs(config);
+    if((config & 0x0100) && readyMode()){
+        readyAsserted = false; // single shot: RDY is released at the start of a conversion
+        updateAlertPin();
+    }
+}
+
+void ADS1x15_Sim::completeConversion(){
+    uint64_t endNs = convEndNs;
+    conversion = convert(convConfig, endNs * 1e-9);
+    newResult = true;
+    simStats.conversions++;
+    converting = false;
+
+    if(readyMode()){
+        readyAsserted = true;
+        /* continuous mode: short pulse, single shot: until the next start */
+        pulseEndNs = (config & 0x0100) ? UINT64_MAX : endNs + RDY_PULSE_NS;
+    }
+    else{
+        comparator(conversion);
+    }
+    updateAlertPin();
+
+    if(!(config & 0x0100)){
+        startConversion(endNs);
+    }
+}
+
+int16_t ADS1x15_Sim::convert(uint16_t conf, double t){
+    uint8_t mux = (conf >> 12) & 7;
+    double vPos = inputs[muxInputs[mux][0]](t);
+    double vNeg = (muxInputs[mux][1] < 0) ? 0.0 : inputs[muxInputs[mux][1]](t);
+    double fsr = fullScale[(conf >> 9) & 7];
+    double maxCode = (chip == SIM_ADS1115) ? 32768.0 : 2048.0;
+    double code = (vPos - vNeg) / fsr * maxCode;
+    if(noiseLsb > 0.0){
+        std::normal_distribution<double> noise(0.0, noiseLsb);
+        code += noise(rng);
+    }
+    code = floor(code + 0.5);
+    if(code > maxCode - 1){
+        code = maxCode - 1;
+    }
+    if(code < -maxCode){
+        code = -maxCode;
+    }
+    int32_t result = static_cast<int32_t>(code);
+    if(chip == SIM_ADS1015){
+        result *= 16; // 12-bit result, left justified
+    }
+    return static_cast<int16_t>(result);
+}
+
+void ADS1x15_Sim::comparator(int16_t value){
+    uint8_t que = config & 3;
+    if(que == 3){
+        compCount = 0;
+        compAsserted = false;
+        return;
+    }
+    int16_t hi = static_cast<int16_t>(hiThresh);
+    int16_t lo = static_cast<int16_t>(loThresh);
+    bool window = config & 0x0010;
+    bool latch = config & 0x0004;
+    bool beyond = window ? ((value > hi) || (value < lo)) : (value > hi);
+    bool backInside = window ? !beyond : (value < lo);
+
+    if(beyond){
+        if(compCount < 4){
+            compCount++;
+        }
+        if(compCount >= (1 << que)){
+            compAsserted = true;
+        }
+    }
+    else{
+        compCount = 0;
+        if(backInside && !latch){
+            compAsserted = false;
+        }
+    }
+}
+
+bool ADS1x15_Sim::readyMode(){
+    return (hiThresh & 0x8000) && !(loThresh & 0x8000);
+}
+
+/* ALERT/RDY is an open drain output */
+void ADS1x15_Sim::updateAlertPin(){
+    if(alertPin < 0){
+        return;
+    }
+    bool disabled = (config & 3) == 3;
+    bool activeHigh = config & 0x0008;
+    bool asserted = alertAsserted();
+    if(disabled || (asserted == activeHigh)){
+        ArduinoHost::releasePin(alertPin);
+    }
+    else{
+        ArduinoHost::drivePin(alertPin, LOW);
+    }
+}
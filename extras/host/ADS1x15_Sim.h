@@ -0,0 +1,124 @@
+/******************************************************************************
+ *
+ * Register level simulation of the ADS1115 and the ADS1015 for host builds.
+ *
+ * Modelled are:
+ * - the config, conversion, Lo_thresh and Hi_thresh registers and the pointer
+ * - single shot and continuous mode, including the OS bit and the conversion
+ *   time per data rate (with an optional oscillator error)
+ * - multiplexer, PGA, 16-bit resp. 12-bit (left justified) results and clipping
+ * - traditional and window comparator, comparator queue, latch, polarity and the
+ *   conversion ready function of the ALERT/RDY pin (open drain)
+ * - general call reset
+ *
+ * The analog inputs are functions of the virtual time, e.g. constant voltages or
+ * sine waves. Attach the device to a TwoWire object with connect().
+ *
+ ******************************************************************************/
+
+#ifndef ADS1X15_SIM_H_
+#define ADS1X15_SIM_H_
+
+#include "Arduino.h"
+#include "Wire.h"
+#include <functional>
+#include <random>
+
+class ADS1x15_Sim : public I2CDevice, public ArduinoHost::EventSource
+{
+    public:
+        typedef enum ADS1X15_SIM_CHIP {
+            SIM_ADS1115,
+            SIM_ADS1015
+        } simChip;
+
+        typedef std::function<double(double)> Waveform; // volts as function of time in s
+
+        struct Stats {
+            uint32_t conversions = 0;
+            uint32_t pointerWrites = 0;     // write transactions (with or without data)
+            uint32_t registerWrites = 0;
+            uint32_t registerReads = 0;
+            uint32_t conversionReads = 0;
+            uint32_t staleReads = 0;        // conversion register read twice without new result
+        };
+
+        ADS1x15_Sim(simChip chip = SIM_ADS1115, uint8_t address = 0x48);
+        ~ADS1x15_Sim();
+
+        void connect(TwoWire &bus);
+        void disconnect();
+
+        /* host pin the ALERT/RDY output is connected to (with pull-up) */
+        void setAlertPin(uint8_t pin);
+
+        /* analog inputs AIN0...AIN3 */
+        void setInput(uint8_t ain, Waveform volts);
+        void setInputVoltage(uint8_t ain, double volts);
+        static Waveform sine(double amplitude, double frequency, double offset = 0.0);
+
+        /* relative deviation of the internal oscillator, e.g. 0.05 -> 5 % faster */
+        void setOscillatorError(double relError);
+        /* gaussian noise in LSB (rms) */
+        void setNoise(double lsbRms, uint32_t seed = 1);
+
+        /* power-on reset */
+        void powerCycle();
+
+        /* inspection */
+        uint16_t getRegister(uint8_t reg);
+        bool isConverting() { return converting; }
+        bool alertAsserted();
+        uint32_t conversionPeriodNs(uint16_t conf);
+        const Stats &stats() { return simStats; }
+        void resetStats() { simStats = Stats(); }
+
+        /* I2CDevice */
+        bool respondsTo(uint8_t addr) override;
+        bool write(const uint8_t *data, size_t len) override;
+        void read(uint8_t *data, size_t len) override;
+        void generalCall(const uint8_t *data, size_t len) override;
+
+        /* ArduinoHost::EventSource */
+        uint64_t nextEventNs() override;
+        void processEvents(uint64_t nowNs) override;
+
+    protected:
+        static constexpr uint32_t RDY_PULSE_NS {8000};
+
+        void writeConfig(uint16_t val);
+        void startConversion(uint64_t startNs);
+        void completeConversion();
+        int16_t convert(uint16_t conf, double t);
+        void comparator(int16_t value);
+        bool readyMode();
+        void updateAlertPin();
+
+        simChip chip;
+        uint8_t address;
+        TwoWire *bus = nullptr;
+        int alertPin = -1;
+
+        uint8_t pointer = 0;
+        uint16_t config = 0x0583;   // without OS bit
+        int16_t conversion = 0;
+        uint16_t loThresh = 0x8000;
+        uint16_t hiThresh = 0x7FFF;
+
+        bool converting = false;
+        uint64_t convEndNs = 0;
+        uint16_t convConfig = 0;    // settings latched at the start of a conversion
+        bool readyAsserted = false;
+        uint64_t pulseEndNs = UINT64_MAX;
+        bool compAsserted = false;
+        uint8_t compCount = 0;
+        bool newResult = false;
+
+        double oscError = 0.0;
+        double noiseLsb = 0.0;
+        std::mt19937 rng;
+        Waveform inputs[4];
+        Stats simStats;
+};
+
+#endif
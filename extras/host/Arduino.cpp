@@ -0,0 +1,291 @@
+/******************************************************************************
+ *
+ * Minimal Arduino core for building the ADS1115_WE library on a Linux host.
+ *
+ ******************************************************************************/
+
+#include "Arduino.h"
+#include <stdio.h>
+#include <vector>
+#include <algorithm>
+#include <mutex>
+
+HostSerial Serial;
+
+namespace
+{
+    struct PinState {
+        uint8_t mode = INPUT;
+        bool driven = false;     // driven from outside (simulated device)
+        int drivenLevel = HIGH;
+        int outputLevel = LOW;   // level set with digitalWrite
+        void (*isr)() = nullptr;
+        int isrMode = 0;
+        bool irqPending = false; // edge while interrupts were blocked
+    };
+
+    const uint64_t PIN_READ_NS = 1000; // time per digitalRead(), roughly an AVR
+    uint64_t hostTimeNs = 0;
+    PinState pins[NUM_DIGITAL_PINS];
+    std::vector<ArduinoHost::EventSource*> sources;
+    std::recursive_mutex hostMutex;
+    bool interruptsEnabled = true;
+    bool inISR = false;
+
+    int pinLevel(uint8_t pin){
+        const PinState &p = pins[pin];
+        if(p.mode == OUTPUT){
+            return p.outputLevel;
+        }
+        if(p.driven){
+            return p.drivenLevel;
+        }
+        return (p.mode == INPUT_PULLUP) ? HIGH : LOW;
+    }
+
+    void runPendingISRs(){
+        if(!interruptsEnabled || inISR){
+            return;
+        }
+        for(PinState &p : pins){
+            if(p.irqPending && p.isr){
+                p.irqPending = false;
+                inISR = true;
+                p.isr();
+                inISR = false;
+            }
+        }
+    }
+
+    void callISR(uint8_t pin, int oldLevel, int newLevel){
+        PinState &p = pins[pin];
+        if(!p.isr || (oldLevel == newLevel)){
+            return;
+        }
+        bool fire = (p.isrMode == CHANGE)
+                    || ((p.isrMode == FALLING) && (newLevel == LOW))
+                    || ((p.isrMode == RISING) && (newLevel == HIGH));
+        if(fire){
+            /* like a real interrupt flag: runs as soon as interrupts are allowed again */
+            p.irqPending = true;
+            runPendingISRs();
+        }
+    }
+}
+
+/* Time */
+
+unsigned long millis(){
+    ArduinoHost::HostLock lock;
+    return static_cast<uint32_t>(hostTimeNs / 1000000ULL);
+}
+
+unsigned long micros(){
+    ArduinoHost::HostLock lock;
+    return static_cast<uint32_t>(hostTimeNs / 1000ULL);
+}
+
+void delay(unsigned long ms){
+    ArduinoHost::HostLock lock;
+    ArduinoHost::advanceNs(ms * 1000000ULL);
+}
+
+void delayMicroseconds(unsigned int us){
+    ArduinoHost::HostLock lock;
+    ArduinoHost::advanceNs(us * 1000ULL);
+}
+
+void yield(){
+    ArduinoHost::HostLock lock;
+    /* a busy loop must not freeze the virtual time */
+    ArduinoHost::advanceNs(1000);
+}
+
+/* Pins and interrupts */
+
+void pinMode(uint8_t pin, uint8_t mode){
+    ArduinoHost::HostLock lock;
+    if(pin < NUM_DIGITAL_PINS){
+        pins[pin].mode = mode;
+    }
+}
+
+int digitalRead(uint8_t pin){
+    ArduinoHost::HostLock lock;
+    /* like yield(): polling a pin must not freeze the virtual time */
+    ArduinoHost::advanceNs(PIN_READ_NS);
+    return (pin < NUM_DIGITAL_PINS) ? pinLevel(pin) : LOW;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val){
+    ArduinoHost::HostLock lock;
+    if(pin < NUM_DIGITAL_PINS){
+        pins[pin].outputLevel = val ? HIGH : LOW;
+    }
+}
+
+void attachInterrupt(int interruptNum, void (*isr)(), int mode){
+    ArduinoHost::HostLock lock;
+    if((interruptNum >= 0) && (interruptNum < NUM_DIGITAL_PINS)){
+        pins[interruptNum].isr = isr;
+        pins[interruptNum].isrMode = mode;
+    }
+}
+
+void detachInterrupt(int interruptNum){
+    ArduinoHost::HostLock lock;
+    if((interruptNum >= 0) && (interruptNum < NUM_DIGITAL_PINS)){
+        pins[interruptNum].isr = nullptr;
+    }
+}
+
+void noInterrupts(){
+    ArduinoHost::HostLock lock;
+    interruptsEnabled = false;
+}
+
+void interrupts(){
+    ArduinoHost::HostLock lock;
+    interruptsEnabled = true;
+    runPendingISRs();
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max){
+    return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+/* Serial */
+
+size_t HostSerial::print(const char *s){
+    return fputs(s, stdout) >= 0 ? strlen(s) : 0;
+}
+
+size_t HostSerial::print(char c){
+    return (putchar(c) == EOF) ? 0 : 1;
+}
+
+size_t HostSerial::write(uint8_t b){
+    return (putchar(b) == EOF) ? 0 : 1;
+}
+
+size_t HostSerial::write(const uint8_t *buf, size_t len){
+    return fwrite(buf, 1, len, stdout);
+}
+
+size_t HostSerial::print(long n, int base){
+    if((base == DEC) && (n < 0)){
+        return print('-') + print(static_cast<unsigned long>(-n), DEC);
+    }
+    return print(static_cast<unsigned long>(n), base);
+}
+
+size_t HostSerial::print(unsigned long n, int base){
+    char buf[8 * sizeof(unsigned long) + 1];
+    char *str = &buf[sizeof(buf) - 1];
+    *str = '\0';
+    if(base < 2){
+        base = DEC;
+    }
+    do{
+        unsigned long digit = n % base;
+        n /= base;
+        *--str = (digit < 10) ? ('0' + digit) : ('A' + digit - 10);
+    }while(n);
+    return print(str);
+}
+
+size_t HostSerial::print(double d, int digits){
+    return printf("%.*f", digits, d);
+}
+
+size_t HostSerial::println(){
+    return print("\r\n");
+}
+
+/* Host control */
+
+namespace ArduinoHost
+{
+    void lock(){
+        hostMutex.lock();
+    }
+
+    void unlock(){
+        hostMutex.unlock();
+    }
+
+    uint64_t nowNs(){
+        HostLock lock;
+        return hostTimeNs;
+    }
+
+    void advanceNs(uint64_t ns){
+        HostLock lock;
+        uint64_t target = hostTimeNs + ns;
+        for(;;){
+            EventSource *next = nullptr;
+            uint64_t nextTime = UINT64_MAX;
+            for(EventSource *src : sources){
+                uint64_t t = src->nextEventNs();
+                if(t < nextTime){
+                    nextTime = t;
+                    next = src;
+                }
+            }
+            if(!next || (nextTime > target)){
+                break;
+            }
+            if(nextTime > hostTimeNs){
+                hostTimeNs = nextTime;
+            }
+            next->processEvents(hostTimeNs);
+        }
+        /* an interrupt routine might have advanced the time already */
+        if(target > hostTimeNs){
+            hostTimeNs = target;
+        }
+    }
+
+    void addEventSource(EventSource *src){
+        HostLock lock;
+        if(std::find(sources.begin(), sources.end(), src) == sources.end()){
+            sources.push_back(src);
+        }
+    }
+
+    void removeEventSource(EventSource *src){
+        HostLock lock;
+        sources.erase(std::remove(sources.begin(), sources.end(), src), sources.end());
+    }
+
+    void drivePin(uint8_t pin, int level){
+        HostLock lock;
+        if(pin >= NUM_DIGITAL_PINS){
+            return;
+        }
+        int oldLevel = pinLevel(pin);
+        pins[pin].driven = true;
+        pins[pin].drivenLevel = level ? HIGH : LOW;
+        callISR(pin, oldLevel, pinLevel(pin));
+    }
+
+    void releasePin(uint8_t pin){
+        HostLock lock;
+        if(pin >= NUM_DIGITAL_PINS){
+            return;
+        }
+        int oldLevel = pinLevel(pin);
+        pins[pin].driven = false;
+        callISR(pin, oldLevel, pinLevel(pin));
+    }
+
+    void reset(){
+        HostLock lock;
+        hostTimeNs = 0;
+        for(PinState &p : pins){
+            p = PinState();
+        }
+        interruptsEnabled = true;
+        inISR = false;
+    }
+}
@@ -0,0 +1,133 @@
+/******************************************************************************
+ *
+ * Minimal Arduino core for building the ADS1115_WE library on a Linux host.
+ *
+ * Time is virtual: millis(), micros(), delay() and all simulated I2C transfers
+ * work on a nanosecond clock which only advances when the sketch waits or uses
+ * the bus (yield() and digitalRead() advance it by 1 µs). Simulated devices (see ADS1x15_Sim.h) register as event sources, so
+ * that conversions complete and pins change at the right virtual time. Pin
+ * changes call the routines registered with attachInterrupt().
+ * All functions lock one host mutex, so sketches can use std::thread. The ISRs
+ * run in the thread which advances the time.
+ *
+ * See extras/host/README.md for build instructions.
+ *
+ ******************************************************************************/
+
+#ifndef ARDUINO_HOST_ARDUINO_H_
+#define ARDUINO_HOST_ARDUINO_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#ifndef ARDUINO
+ #define ARDUINO 10819
+#endif
+#define ARDUINO_HOST 1
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT        0x0
+#define OUTPUT       0x1
+#define INPUT_PULLUP 0x2
+
+#define CHANGE  1
+#define FALLING 2
+#define RISING  3
+
+#define NUM_DIGITAL_PINS 64
+#define digitalPinToInterrupt(p) ((p) < NUM_DIGITAL_PINS ? (p) : -1)
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t val);
+void attachInterrupt(int interruptNum, void (*isr)(), int mode);
+void detachInterrupt(int interruptNum);
+void noInterrupts();
+void interrupts();
+
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class HostSerial
+{
+    public:
+        void begin(unsigned long) {}
+        size_t print(const char *s);
+        size_t print(char c);
+        size_t write(uint8_t b);
+        size_t write(const uint8_t *buf, size_t len);
+        size_t print(int n, int base = DEC) { return print(static_cast<long>(n), base); }
+        size_t print(unsigned int n, int base = DEC) { return print(static_cast<unsigned long>(n), base); }
+        size_t print(long n, int base = DEC);
+        size_t print(unsigned long n, int base = DEC);
+        size_t print(double d, int digits = 2);
+        size_t println();
+        template<typename T> size_t println(T val){
+            size_t n = print(val);
+            return n + println();
+        }
+        template<typename T> size_t println(T val, int format){
+            size_t n = print(val, format);
+            return n + println();
+        }
+        explicit operator bool() { return true; }
+};
+extern HostSerial Serial;
+
+/* Control interface of the virtual host, not part of the Arduino API */
+namespace ArduinoHost
+{
+    /* Anything that changes state over time, e.g. a simulated ADC */
+    class EventSource
+    {
+        public:
+            virtual ~EventSource() {}
+            /* virtual time of the next event in ns, UINT64_MAX if none is scheduled */
+            virtual uint64_t nextEventNs() = 0;
+            /* process all events up to and including nowNs */
+            virtual void processEvents(uint64_t nowNs) = 0;
+    };
+
+    uint64_t nowNs();
+    void advanceNs(uint64_t ns);
+    void addEventSource(EventSource *src);
+    void removeEventSource(EventSource *src);
+
+    /* Level driven from outside (e.g. an open drain ALERT pin), LOW or HIGH */
+    void drivePin(uint8_t pin, int level);
+    /* Releases the pin, it reads HIGH with INPUT_PULLUP */
+    void releasePin(uint8_t pin);
+
+    /* Resets time, pins and interrupts */
+    void reset();
+
+    /* Host mutex (recursive), locked by all functions of the host core and of Wire */
+    void lock();
+    void unlock();
+    struct HostLock
+    {
+        HostLock() { lock(); }
+        ~HostLock() { unlock(); }
+    };
+}
+
+#endif
@@ -0,0 +1,204 @@
+/******************************************************************************
+ *
+ * TwoWire for the Linux host build of the ADS1115_WE library.
+ *
+ ******************************************************************************/
+
+#include "Wire.h"
+#include <thread>
+
+TwoWire Wire;
+
+namespace
+{
+    thread_local char threadToken; // its address identifies the thread
+}
+
+void TwoWire::beginTransmission(uint8_t address){
+    threadSwitch();
+    ArduinoHost::HostLock lock;
+    claimBus(false);
+    txAddress = address;
+    txLength = 0;
+}
+
+size_t TwoWire::write(uint8_t data){
+    ArduinoHost::HostLock lock;
+    if(txLength >= WIRE_HOST_BUFFER_SIZE){
+        return 0;
+    }
+    txBuffer[txLength++] = data;
+    return 1;
+}
+
+size_t TwoWire::write(const uint8_t *data, size_t quantity){
+    size_t n = 0;
+    while((n < quantity) && write(data[n])){
+        n++;
+    }
+    return n;
+}
+
+uint8_t TwoWire::endTransmission(bool sendStop){
+    threadSwitch();
+    ArduinoHost::HostLock lock;
+    claimBus(sendStop);
+    /* master code 0000 1xxx: 7-bit addresses 0x04 to 0x07 */
+    if((txAddress >= 0x04) && (txAddress <= 0x07)){
+        bool stop = sendStop || stopAfterNack;
+        if(clockHz > 400000){
+            busStats.framingErrors++;
+        }
+        else if(!stop){
+            busStats.hsEntries++;
+        }
+        busTransfer(1 + txLength, stop);
+        hsMode = !stop && (clockHz <= 400000);
+        return 2;  // not acknowledged by design
+    }
+    if(!checkFraming()){
+        busTransfer(1 + txLength, sendStop || stopAfterNack);
+        busStats.nacks++;
+        return 2;
+    }
+    busTransfer(1 + txLength, sendStop);
+    if(txAddress == 0){
+        for(I2CDevice *dev : devices){
+            if(dev){
+                dev->generalCall(txBuffer, txLength);
+            }
+        }
+        return 0;
+    }
+    I2CDevice *dev = findDevice(txAddress);
+    if(!dev){
+        busStats.nacks++;
+        if(stopAfterNack){
+            hsMode = false;
+        }
+        return 2;  // address NACK
+    }
+    if(!dev->write(txBuffer, txLength)){
+        busStats.nacks++;
+        return 3;  // data NACK
+    }
+    return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity, bool sendStop){
+    threadSwitch();
+    ArduinoHost::HostLock lock;
+    claimBus(false); // until the received bytes are read
+    rxIndex = 0;
+    rxLength = 0;
+    if(quantity > WIRE_HOST_BUFFER_SIZE){
+        quantity = WIRE_HOST_BUFFER_SIZE;
+    }
+    I2CDevice *dev = checkFraming() ? findDevice(address) : nullptr;
+    if(!dev){
+        busTransfer(1, sendStop || stopAfterNack);
+        busStats.nacks++;
+        claimBus(true);
+        return 0;
+    }
+    busTransfer(1 + quantity, sendStop);
+    dev->read(rxBuffer, quantity);
+    rxLength = quantity;
+    return quantity;
+}
+
+int TwoWire::available(){
+    ArduinoHost::HostLock lock;
+    return rxLength - rxIndex;
+}
+
+int TwoWire::read(){
+    ArduinoHost::HostLock lock;
+    if(rxIndex >= rxLength){
+        return -1;
+    }
+    if(rxIndex + 1 == rxLength){
+        claimBus(true);
+    }
+    return rxBuffer[rxIndex++];
+}
+
+int TwoWire::peek(){
+    ArduinoHost::HostLock lock;
+    return (rxIndex < rxLength) ? rxBuffer[rxIndex] : -1;
+}
+
+void TwoWire::attachDevice(I2CDevice *dev){
+    for(I2CDevice *&slot : devices){
+        if(!slot){
+            slot = dev;
+            return;
+        }
+    }
+}
+
+void TwoWire::detachDevice(I2CDevice *dev){
+    for(I2CDevice *&slot : devices){
+        if(slot == dev){
+            slot = nullptr;
+        }
+    }
+}
+
+I2CDevice *TwoWire::findDevice(uint8_t address){
+    for(I2CDevice *dev : devices){
+        if(dev && dev->respondsTo(address)){
+            return dev;
+        }
+    }
+    return nullptr;
+}
+
+/* START (or repeated START), 9 clocks per byte (8 bits + ACK), STOP */
+void TwoWire::busTransfer(size_t bytes, bool stop){
+    uint64_t bits = 1 + 9 * bytes + (stop ? 1 : 0);
+    uint64_t ns = bits * 1000000000ULL / clockHz;
+    busStats.transactions++;
+    busStats.bytes += bytes;
+    busStats.busTimeNs += ns;
+    if(hsMode){
+        busStats.hsTransfers++;
+    }
+    if(stop){
+        hsMode = false; // a STOP ends the Hs-mode
+    }
+    ArduinoHost::advanceNs(ns + overheadNs);
+}
+
+/* Clocks above 1 MHz (Fast-mode Plus) are only allowed in Hs-mode */
+bool TwoWire::checkFraming(){
+    if((clockHz > 1000000) && !hsMode){
+        busStats.framingErrors++;
+        return false;
+    }
+    return true;
+}
+
+/* Counts transfers of another thread into an open transaction (no START/STOP framing) */
+void TwoWire::claimBus(bool release){
+    if(busOwner && (busOwner != &threadToken)){
+        busStats.interleaved++;
+    }
+    if(lastThread && (lastThread != &threadToken)){
+        multiThreaded = true;
+    }
+    lastThread = &threadToken;
+    busOwner = release ? nullptr : &threadToken;
+}
+
+/* Transfers take real time: lets other threads run between the steps of a transaction */
+void TwoWire::threadSwitch(){
+    bool switchThread;
+    {
+        ArduinoHost::HostLock lock;
+        switchThread = multiThreaded;
+    }
+    if(switchThread){
+        std::this_thread::yield();
+    }
+}
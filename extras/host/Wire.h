@@ -0,0 +1,111 @@
+/******************************************************************************
+ *
+ * TwoWire for the Linux host build of the ADS1115_WE library.
+ *
+ * Instead of real hardware, simulated devices (I2CDevice) are attached to the
+ * bus. Every transfer advances the virtual clock by the time it would take on a
+ * real bus at the clock set with setClock(). The bus also counts transactions
+ * and bytes, so that the costs of driver functions can be measured. If several
+ * threads use the bus, it counts transfers which break into a transaction of
+ * another thread (e.g. between the pointer write and the read of a register).
+ *
+ * Hs-mode framing is checked: clocks above 1 MHz are only allowed after a master
+ * code (0000 1xxx, sent at up to 400 kHz and not acknowledged) and until the next
+ * STOP. Transfers which violate this count as framing errors and are not
+ * acknowledged by any device.
+ *
+ ******************************************************************************/
+
+#ifndef ARDUINO_HOST_WIRE_H_
+#define ARDUINO_HOST_WIRE_H_
+
+#include "Arduino.h"
+
+#define WIRE_HOST_BUFFER_SIZE 32
+
+/* Interface for simulated I2C slaves */
+class I2CDevice
+{
+    public:
+        virtual ~I2CDevice() {}
+        virtual bool respondsTo(uint8_t address) = 0;
+        /* master writes: data phase of a write transaction, returns false for a NACK */
+        virtual bool write(const uint8_t *data, size_t len) = 0;
+        /* master reads: fills len bytes */
+        virtual void read(uint8_t *data, size_t len) = 0;
+        /* general call (address 0) */
+        virtual void generalCall(const uint8_t *, size_t) {}
+};
+
+struct I2CBusStats
+{
+    uint32_t transactions = 0;   // address phases (START or repeated START)
+    uint32_t bytes = 0;          // address and data bytes
+    uint32_t nacks = 0;
+    uint32_t interleaved = 0;    // transfers of another thread while a transaction was open
+    uint32_t hsEntries = 0;      // master codes followed by a repeated START
+    uint32_t hsTransfers = 0;    // transfers in Hs-mode
+    uint32_t framingErrors = 0;  // clock above 1 MHz outside Hs-mode, master code above 400 kHz
+    uint64_t busTimeNs = 0;
+};
+
+class TwoWire
+{
+    public:
+        void begin() {}
+        void end() {}
+        void setClock(uint32_t freq) { clockHz = freq; }
+        uint32_t getClock() { return clockHz; }
+
+        void beginTransmission(uint8_t address);
+        void beginTransmission(int address) { beginTransmission(static_cast<uint8_t>(address)); }
+        size_t write(uint8_t data);
+        size_t write(const uint8_t *data, size_t quantity);
+        uint8_t endTransmission(bool sendStop = true);
+        uint8_t requestFrom(uint8_t address, uint8_t quantity, bool sendStop = true);
+        uint8_t requestFrom(int address, int quantity) {
+            return requestFrom(static_cast<uint8_t>(address), static_cast<uint8_t>(quantity));
+        }
+        int available();
+        int read();
+        int peek();
+
+        /* Host interface */
+        void attachDevice(I2CDevice *dev);
+        void detachDevice(I2CDevice *dev);
+        const I2CBusStats &stats() { return busStats; }
+        void resetStats() { busStats = I2CBusStats(); }
+        /* additional CPU time per transaction (driver and Wire library overhead) */
+        void setTransactionOverheadNs(uint32_t ns) { overheadNs = ns; }
+        /* emulates cores which always send a STOP after a NACK (no Hs-mode possible) */
+        void setStopAfterNack(bool stop) { stopAfterNack = stop; }
+        bool isHsMode() { return hsMode; }
+
+    protected:
+        I2CDevice *findDevice(uint8_t address);
+        void busTransfer(size_t bytes, bool stop);
+        bool checkFraming();
+        void claimBus(bool release);
+        void threadSwitch();
+
+        static constexpr uint8_t MAX_DEVICES {8};
+        I2CDevice *devices[MAX_DEVICES] = {nullptr};
+        uint32_t clockHz = 100000;
+        uint32_t overheadNs = 0;
+        uint8_t txAddress = 0;
+        uint8_t txBuffer[WIRE_HOST_BUFFER_SIZE];
+        size_t txLength = 0;
+        uint8_t rxBuffer[WIRE_HOST_BUFFER_SIZE];
+        size_t rxLength = 0;
+        size_t rxIndex = 0;
+        I2CBusStats busStats;
+        const void *busOwner = nullptr; // thread with an open transaction
+        const void *lastThread = nullptr;
+        bool multiThreaded = false;     // used by more than one thread so far
+        bool hsMode = false;
+        bool stopAfterNack = false;
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,324 @@
+/******************************************************************************
+ *
+ * Throughput and latency benchmark for the acquisition paths of ADS1115_WE.
+ *
+ * Every path runs against the simulated ADS1115 and ADS1015 at every data rate
+ * and at 100 kHz, 400 kHz and 1 MHz bus clock (the Hs-mode path runs at 3.4 MHz
+ * after a master code at the given clock). Results are printed as one JSON
+ * object per line (or CSV with --csv):
+ *
+ *   sps             distinct conversions delivered per (virtual) second
+ *   us_per_sample   virtual time per delivered conversion
+ *   us_per_call     virtual time per call of the measured function
+ *   tx_per_sample   I2C transactions per delivered conversion
+ *   bytes_per_sample
+ *   stale_reads     conversion register reads without a new result
+ *   missed          conversions reported as missed by readBlock()
+ *
+ * The virtual time includes bus transfers and waiting, but not the CPU time of
+ * the MCU. Build instructions: see extras/host/README.md.
+ *
+ * Usage: ./ads1115_benchmark [--csv] [--samples N] [--overhead-ns NS]
+ *   --samples      conversions per measurement (default 32)
+ *   --overhead-ns  CPU time per I2C transaction to add (default 0)
+ *
+ ******************************************************************************/
+
+#include "Arduino.h"
+#include "Wire.h"
+#include "ADS1x15_Sim.h"
+#include "ADS1115_WE.h"
+#include "ADS1115_Scanner.h"
+#include "ADS1115_Array.h"
+#include <stdio.h>
+
+namespace
+{
+    struct Result {
+        uint32_t samples = 0;
+        uint32_t calls = 0;
+        uint64_t startNs = 0;   // a path may move the start, e.g. behind its own setup
+        uint64_t timeNs = 0;
+        uint32_t transactions = 0;
+        uint32_t bytes = 0;
+        uint32_t staleReads = 0;
+        uint32_t missed = 0;
+    };
+
+    typedef void (*PathFunction)(ADS1115_WE &adc, ADS1x15_Sim &sim, uint32_t samples, Result &res);
+
+    const ADS1115_CONV_RATE rates[8] = {ADS1115_8_SPS, ADS1115_16_SPS, ADS1115_32_SPS, ADS1115_64_SPS,
+                                        ADS1115_128_SPS, ADS1115_250_SPS, ADS1115_475_SPS, ADS1115_860_SPS};
+    const uint16_t ads1115Sps[8] = {8, 16, 32, 64, 128, 250, 475, 860};
+    const uint16_t ads1015Sps[8] = {128, 250, 490, 920, 1600, 2400, 3300, 3300};
+    const uint32_t clocks[3] = {100000, 400000, 1000000};
+
+    volatile int32_t sink; // keeps results alive
+    ADS1x15_Sim::simChip currentChip = ADS1x15_Sim::SIM_ADS1115;
+
+    uint32_t newConversions(ADS1x15_Sim &sim){
+        return sim.stats().conversionReads - sim.stats().staleReads;
+    }
+
+    /* single shot, OS bit polled with isBusy() */
+    void singleShotPolling(ADS1115_WE &adc, ADS1x15_Sim &, uint32_t samples, Result &res){
+        adc.setCompareChannels(ADS1115_COMP_0_GND);
+        for(uint32_t i=0; i<samples; i++){
+            adc.startSingleMeasurement();
+            while(adc.isBusy()){}
+            sink = adc.getRawResult();
+            res.calls++;
+        }
+        res.samples = samples;
+    }
+
+    /* continuous mode, polling the conversion register as fast as possible */
+    template<int32_t (*READ)(ADS1115_WE &)>
+    void continuousPolling(ADS1115_WE &adc, ADS1x15_Sim &sim, uint32_t samples, Result &res){
+        adc.setCompareChannels(ADS1115_COMP_0_GND);
+        adc.setMeasureMode(ADS1115_CONTINUOUS);
+        sim.resetStats();
+        while(newConversions(sim) < samples){
+            sink = READ(adc);
+            res.calls++;
+        }
+        res.samples = newConversions(sim);
+    }
+
+    int32_t readRaw(ADS1115_WE &adc) { return adc.getRawResult(); }
+    int32_t readMillivolts(ADS1115_WE &adc) { return static_cast<int32_t>(adc.getResult_mV()); }
+    int32_t readWithRange(ADS1115_WE &adc) { return adc.getResultWithRange(-1023, 1023); }
+
+    /* continuous mode, four channels with setSingleChannel() */
+    void singleChannelScan(ADS1115_WE &adc, ADS1x15_Sim &, uint32_t samples, Result &res){
+        adc.setMeasureMode(ADS1115_CONTINUOUS);
+        for(uint32_t i=0; i<samples; i++){
+            adc.setSingleChannel(i % 4);
+            sink = adc.getRawResult();
+            res.calls++;
+        }
+        res.samples = samples;
+    }
+
+    /* as above, but the waits are based on the measured conversion time */
+    void singleChannelScanCalibrated(ADS1115_WE &adc, ADS1x15_Sim &sim, uint32_t samples, Result &res){
+        /* calibrated at the lowest rate (resolution of the OS bit polling), applies to all rates */
+        ADS1115_CONV_RATE rate = adc.getConvRate();
+        adc.setConvRate(ADS1115_8_SPS);
+        adc.calibrateConvRate();
+        adc.setConvRate(rate);
+        Wire.resetStats();
+        res.startNs = ArduinoHost::nowNs();
+        singleChannelScan(adc, sim, samples, res);
+        adc.resetConvRateCalibration();
+    }
+
+    /* continuous mode, permanent auto range, input sweeps through all ranges */
+    void permanentAutoRange(ADS1115_WE &adc, ADS1x15_Sim &sim, uint32_t samples, Result &res){
+        adc.setCompareChannels(ADS1115_COMP_3_GND);
+        adc.setMeasureMode(ADS1115_CONTINUOUS);
+        adc.setPermanentAutoRangeMode(true);
+        sim.resetStats();
+        while(newConversions(sim) < samples){
+            sink = adc.getRawResult();
+            res.calls++;
+        }
+        res.samples = newConversions(sim);
+        adc.setPermanentAutoRangeMode(false);
+    }
+
+    /* non-blocking scanner over four channels, polling */
+    void scanner(ADS1115_WE &adc, ADS1x15_Sim &, uint32_t samples, Result &res){
+        static const ADS1115_MUX list[4] = {ADS1115_COMP_0_GND, ADS1115_COMP_1_GND,
+                                            ADS1115_COMP_2_GND, ADS1115_COMP_3_GND};
+        ADS1115_Scanner scan(adc);
+        scan.begin(list, 4);
+        while(scan.getScanCount() * 4 < samples){
+            scan.update();
+            res.calls++;
+            yield(); // the rest of the loop; update() does not advance the virtual time before the conversion is due
+        }
+        res.samples = scan.getScanCount() * 4;
+        scan.stop();
+    }
+
+    /* four devices (0x48 to 0x4B), four channels each, conversions overlap */
+    void array4x4(ADS1115_WE &adc, ADS1x15_Sim &, uint32_t samples, Result &res){
+        ADS1115_WE more[3] = {ADS1115_WE(0x49), ADS1115_WE(0x4A), ADS1115_WE(0x4B)};
+        ADS1115_Array array;
+        array.addDevice(adc);
+        for(ADS1115_WE &dev : more){
+            dev.init(currentChip == ADS1x15_Sim::SIM_ADS1015);
+            dev.setVoltageRange_mV(ADS1115_RANGE_6144);
+            dev.setConvRate(adc.getConvRate());
+            array.addDevice(dev);
+        }
+        /* without the setup of the additional devices */
+        Wire.resetStats();
+        res.startNs = ArduinoHost::nowNs();
+        array.begin(4);
+        while(array.getFrameCount() * 16 < samples){
+            array.update();
+            res.calls++;
+            yield();
+        }
+        res.samples = array.getFrameCount() * 16;
+        array.stop();
+    }
+
+    /* readBlock(), single shot conversions chained via the OS bit */
+    void readBlockOsBit(ADS1115_WE &adc, ADS1x15_Sim &, uint32_t samples, Result &res){
+        int16_t buf[64];
+        adc.setCompareChannels(ADS1115_COMP_0_GND);
+        while(res.samples < samples){
+            uint32_t n = (samples - res.samples < 64) ? samples - res.samples : 64;
+            res.samples += adc.readBlock(buf, n);
+            res.calls++;
+        }
+    }
+
+    /* readBlock(), continuous mode synchronized with the ready pin */
+    void readBlockReadyPin(ADS1115_WE &adc, ADS1x15_Sim &, uint32_t samples, Result &res){
+        int16_t buf[64];
+        pinMode(2, INPUT_PULLUP);
+        adc.setReadyPin(2);
+        adc.setCompareChannels(ADS1115_COMP_0_GND);
+        while(res.samples < samples){
+            uint32_t n = (samples - res.samples < 64) ? samples - res.samples : 64;
+            res.samples += adc.readBlock(buf, n);
+            res.missed += adc.getMissedConversions();
+            res.calls++;
+        }
+        adc.setReadyPin(-1);
+    }
+
+    /* readBlock() with ready pin in an Hs-mode session (3.4 MHz), master code at up to 400 kHz */
+    void readBlockReadyPinHs(ADS1115_WE &adc, ADS1x15_Sim &sim, uint32_t samples, Result &res){
+        uint32_t fsClock = (Wire.getClock() < 400000) ? Wire.getClock() : 400000;
+        adc.beginHsSession(3400000, fsClock);
+        readBlockReadyPin(adc, sim, samples, res);
+        adc.endHsSession();
+    }
+
+    struct Path {
+        const char *name;
+        PathFunction run;
+    };
+
+    const Path paths[] = {
+        {"single_shot_isBusy", singleShotPolling},
+        {"continuous_getRawResult", continuousPolling<readRaw>},
+        {"continuous_getResult_mV", continuousPolling<readMillivolts>},
+        {"continuous_getResultWithRange", continuousPolling<readWithRange>},
+        {"setSingleChannel_scan", singleChannelScan},
+        {"setSingleChannel_scan_calibrated", singleChannelScanCalibrated},
+        {"permanent_auto_range", permanentAutoRange},
+        {"scanner_nonblocking", scanner},
+        {"array_4_devices_nonblocking", array4x4},
+        {"readBlock_os_bit", readBlockOsBit},
+        {"readBlock_ready_pin", readBlockReadyPin},
+        {"readBlock_ready_pin_hs", readBlockReadyPinHs},
+    };
+
+    Result runPath(const Path &path, ADS1x15_Sim::simChip chip, uint8_t rateIdx, uint32_t clock,
+                   uint32_t samples, uint32_t overheadNs){
+        ArduinoHost::reset();
+        ADS1x15_Sim sim(chip, 0x48);
+        sim.setInputVoltage(0, 1.0);
+        sim.setInputVoltage(1, 0.2);
+        sim.setInputVoltage(2, -0.05);
+        /* sweeps from 0 to 5 V, so that auto range has to switch */
+        sim.setInput(3, ADS1x15_Sim::sine(2.5, 0.5, 2.5));
+        sim.setNoise(0.5);
+        sim.setAlertPin(2);
+        sim.connect(Wire);
+        /* more devices for the array path, idle otherwise */
+        ADS1x15_Sim more[3] = {{chip, 0x49}, {chip, 0x4A}, {chip, 0x4B}};
+        for(ADS1x15_Sim &dev : more){
+            dev.setInputVoltage(0, 1.0);
+            dev.setInputVoltage(1, 0.2);
+            dev.setInputVoltage(2, -0.05);
+            dev.setInputVoltage(3, 2.5);
+            dev.connect(Wire);
+        }
+        currentChip = chip;
+        Wire.setClock(clock);
+        Wire.setTransactionOverheadNs(overheadNs);
+
+        ADS1115_WE adc(0x48);
+        adc.init(chip == ADS1x15_Sim::SIM_ADS1015);
+        adc.setVoltageRange_mV(ADS1115_RANGE_6144);
+        adc.setConvRate(rates[rateIdx]);
+
+        Result res;
+        Wire.resetStats();
+        sim.resetStats();
+        res.startNs = ArduinoHost::nowNs();
+        path.run(adc, sim, samples, res);
+        res.timeNs = ArduinoHost::nowNs() - res.startNs;
+        res.transactions = Wire.stats().transactions;
+        res.bytes = Wire.stats().bytes;
+        res.staleReads = sim.stats().staleReads;
+        sim.disconnect();
+        for(ADS1x15_Sim &dev : more){
+            dev.disconnect();
+        }
+        return res;
+    }
+}
+
+int main(int argc, char **argv){
+    bool csv = false;
+    uint32_t samples = 32;
+    uint32_t overheadNs = 0;
+    for(int i=1; i<argc; i++){
+        if(strcmp(argv[i], "--csv") == 0){
+            csv = true;
+        }
+        else if((strcmp(argv[i], "--samples") == 0) && (i + 1 < argc)){
+            samples = strtoul(argv[++i], nullptr, 10);
+        }
+        else if((strcmp(argv[i], "--overhead-ns") == 0) && (i + 1 < argc)){
+            overheadNs = strtoul(argv[++i], nullptr, 10);
+        }
+        else{
+            fprintf(stderr, "usage: %s [--csv] [--samples N] [--overhead-ns NS]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if(csv){
+        printf("chip,path,rate_sps,i2c_hz,samples,sps,us_per_sample,us_per_call,tx_per_sample,bytes_per_sample,stale_reads,missed\n");
+    }
+    for(int c=0; c<2; c++){
+        ADS1x15_Sim::simChip chip = c ? ADS1x15_Sim::SIM_ADS1015 : ADS1x15_Sim::SIM_ADS1115;
+        const char *chipName = c ? "ADS1015" : "ADS1115";
+        for(const Path &path : paths){
+            for(uint8_t r=0; r<8; r++){
+                uint16_t sps = c ? ads1015Sps[r] : ads1115Sps[r];
+                for(uint32_t clock : clocks){
+                    Result res = runPath(path, chip, r, clock, samples, overheadNs);
+                    double seconds = res.timeNs * 1e-9;
+                    double effSps = res.samples / seconds;
+                    double usPerSample = res.timeNs * 1e-3 / res.samples;
+                    double usPerCall = res.timeNs * 1e-3 / res.calls;
+                    double txPerSample = 1.0 * res.transactions / res.samples;
+                    double bytesPerSample = 1.0 * res.bytes / res.samples;
+                    if(csv){
+                        printf("%s,%s,%u,%u,%u,%.2f,%.1f,%.1f,%.2f,%.2f,%u,%u\n", chipName, path.name, sps, clock,
+                               res.samples, effSps, usPerSample, usPerCall, txPerSample, bytesPerSample, res.staleReads,
+                               res.missed);
+                    }
+                    else{
+                        printf("{\"chip\":\"%s\",\"path\":\"%s\",\"rate_sps\":%u,\"i2c_hz\":%u,\"samples\":%u,"
+                               "\"sps\":%.2f,\"us_per_sample\":%.1f,\"us_per_call\":%.1f,\"tx_per_sample\":%.2f,"
+                               "\"bytes_per_sample\":%.2f,\"stale_reads\":%u,\"missed\":%u}\n", chipName, path.name, sps,
+                               clock, res.samples, effSps, usPerSample, usPerCall, txPerSample, bytesPerSample,
+                               res.staleReads, res.missed);
+                    }
+                }
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,225 @@
+/******************************************************************************
+ *
+ * Checks and benchmarks the block conversions of ADS1115_Convert against the
+ * scalar path, i.e. the calculation of getResult_mV(), getResult_uV() and
+ * getResultWithRange() for one value per call:
+ *
+ * 1. The results are identical for all 65536 raw values in all ranges (mV with
+ *    gain 1 and offset 0, µV, mapped ranges incl. negative spans and the
+ *    maxMillivolt variant). With gain and offset, the difference to the exact
+ *    value is below 1e-6 (relative). Odd block sizes (rest loop) and in place
+ *    conversion of the mapped ranges work.
+ * 2. Time per sample of the scalar path and of the block conversion for blocks
+ *    of --samples values (default 1048576), as JSON lines or CSV (--csv).
+ *
+ * The scalar path calls the static helpers of ADS1115_WE which getResult_mV(),
+ * getResult_uV() and getResultWithRange() use, so the check follows changes of
+ * the library. The wrappers are not inlined, like the library functions called
+ * per sample. Build: see extras/host/README.md, build once more with
+ * -DADS1115_NO_SIMD to compare the plain loops. Returns 1 if a check failed.
+ *
+ ******************************************************************************/
+
+#include "Arduino.h"
+#include "ADS1115_WE.h"
+#include "ADS1115_Convert.h"
+#include "host_check.h"
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+namespace
+{
+    const ADS1115_RANGE ranges[6] = {ADS1115_RANGE_6144, ADS1115_RANGE_4096, ADS1115_RANGE_2048,
+                                     ADS1115_RANGE_1024, ADS1115_RANGE_0512, ADS1115_RANGE_0256};
+    volatile int64_t sink; // keeps results alive
+
+    /* the scalar path: the helpers of the ADS1115_WE functions (the SSE2 path does not use them) */
+    __attribute__((noinline)) float scalarMilliVolts(int16_t raw, uint16_t voltageRange){
+        return ADS1115_WE::rawToMillivoltsFixed(raw, voltageRange) / 65536.0; // getResult_mV()
+    }
+
+    __attribute__((noinline)) int32_t scalarMicroVolts(int16_t raw, uint16_t voltageRange){
+        return ADS1115_WE::rawToMicrovolts(raw, voltageRange >> 8);
+    }
+
+    __attribute__((noinline)) int16_t scalarRange(int16_t raw, int16_t min, int16_t max){
+        return ADS1115_WE::rawToRange(raw, min, max);
+    }
+
+    int16_t scalarRange(int16_t raw, int16_t min, int16_t max, int16_t maxMillivolt, uint16_t voltageRange){
+        return ADS1115_WE::rangeToMillivoltScale(scalarRange(raw, min, max), voltageRange, maxMillivolt);
+    }
+
+    double nowNs(){
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void checkAllValues(){
+        /* 65535 values: odd number, so the rest loop is used, too */
+        std::vector<int16_t> raw(65536);
+        for(size_t i=0; i<raw.size(); i++){
+            raw[i] = static_cast<int16_t>(i - 32768);
+        }
+        std::vector<float> mV(raw.size());
+        std::vector<int32_t> uV(raw.size());
+        std::vector<int16_t> out(raw.size());
+        size_t n = raw.size() - 1;
+
+        printf("1. Batch = scalar for all raw values\n");
+        bool mVOk = true;
+        bool uVOk = true;
+        bool gainOk = true;
+        for(ADS1115_RANGE range : ranges){
+            uint16_t voltageRange = ADS1115_WE::rangeToMillivolts(range);
+            ADS1115_Convert::convertToMilliVolts(raw.data() + 1, mV.data(), n, range);
+            ADS1115_Convert::convertToMicroVolts(raw.data() + 1, uV.data(), n, range);
+            for(size_t i=0; i<n; i++){
+                mVOk &= (mV[i] == scalarMilliVolts(raw[i + 1], voltageRange));
+                uVOk &= (uV[i] == scalarMicroVolts(raw[i + 1], voltageRange));
+            }
+            ADS1115_Convert::convertToMilliVolts(raw.data(), mV.data(), n, range, 1.0037, -12.5);
+            ADS1115_Convert::convertToMicroVolts(raw.data(), uV.data(), n, range, -1500);
+            for(size_t i=0; i<n; i++){
+                double exact = raw[i] * (voltageRange / 32768.0) * 1.0037 - 12.5;
+                gainOk &= (fabs(mV[i] - exact) <= 1e-6 * (fabs(exact) + 1.0));
+                uVOk &= (uV[i] == scalarMicroVolts(raw[i], voltageRange) - 1500);
+            }
+        }
+        check(mVOk, "convertToMilliVolts() = getResult_mV(), all ranges");
+        check(gainOk, "convertToMilliVolts() with gain and offset");
+        check(uVOk, "convertToMicroVolts() = getResult_uV(), with and without offset");
+
+        const int16_t limits[][2] = {{-1023, 1023}, {0, 1023}, {1023, 0}, {0, 4095}, {-32768, 32767},
+                                     {32767, -32768}, {0, 0}, {-5, 5}, {100, -100}, {-32768, -32767}};
+        bool rangeOk = true;
+        for(const int16_t *limit : limits){
+            ADS1115_Convert::convertToRange(raw.data(), out.data(), n, limit[0], limit[1]);
+            for(size_t i=0; i<n; i++){
+                rangeOk &= (out[i] == scalarRange(raw[i], limit[0], limit[1]));
+            }
+        }
+        check(rangeOk, "convertToRange(min, max) = getResultWithRange(min, max)");
+
+        const int16_t maxMillivolts[] = {5000, 3300, -3300, 1, 0};
+        bool maxMvOk = true;
+        for(ADS1115_RANGE range : ranges){
+            uint16_t voltageRange = ADS1115_WE::rangeToMillivolts(range);
+            for(int16_t maxMillivolt : maxMillivolts){
+                ADS1115_Convert::convertToRange(raw.data(), out.data(), n, -1023, 1023, maxMillivolt, range);
+                for(size_t i=0; i<n; i++){
+                    maxMvOk &= (out[i] == scalarRange(raw[i], -1023, 1023, maxMillivolt, voltageRange));
+                }
+            }
+        }
+        check(maxMvOk, "convertToRange(min, max, maxMillivolt) = getResultWithRange(min, max, maxMillivolt)");
+
+        std::vector<int16_t> inPlace(raw);
+        ADS1115_Convert::convertToRange(inPlace.data(), inPlace.data(), n, -1023, 1023);
+        bool inPlaceOk = true;
+        for(size_t i=0; i<n; i++){
+            inPlaceOk &= (inPlace[i] == scalarRange(raw[i], -1023, 1023));
+        }
+        inPlaceOk &= (inPlace[n] == raw[n]);
+        check(inPlaceOk, "convertToRange() in place, last value untouched");
+    }
+
+    void printResult(bool csv, const char *conversion, size_t samples, double scalarNs, double batchNs){
+        if(csv){
+            printf("%s,%s,%zu,%.3f,%.3f,%.1f\n", conversion, ADS1115_Convert::hasSimd() ? "sse2" : "plain",
+                   samples, scalarNs, batchNs, scalarNs / batchNs);
+        }
+        else{
+            printf("{\"conversion\":\"%s\",\"batch_path\":\"%s\",\"samples\":%zu,\"scalar_ns_per_sample\":%.3f,"
+                   "\"batch_ns_per_sample\":%.3f,\"speedup\":%.1f}\n", conversion,
+                   ADS1115_Convert::hasSimd() ? "sse2" : "plain", samples, scalarNs, batchNs, scalarNs / batchNs);
+        }
+    }
+
+    /* best of several runs, in ns per sample */
+    template<typename F>
+    double measure(size_t samples, F run){
+        double best = 1e30;
+        for(int rep=0; rep<7; rep++){
+            double start = nowNs();
+            run();
+            double t = (nowNs() - start) / samples;
+            best = (t < best) ? t : best;
+        }
+        return best;
+    }
+}
+
+int main(int argc, char **argv){
+    bool csv = false;
+    size_t samples = 1 << 20;
+    for(int i=1; i<argc; i++){
+        if(strcmp(argv[i], "--csv") == 0){
+            csv = true;
+        }
+        else if((strcmp(argv[i], "--samples") == 0) && (i + 1 < argc)){
+            samples = strtoul(argv[++i], nullptr, 10);
+        }
+        else{
+            fprintf(stderr, "usage: %s [--csv] [--samples N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    checkAllValues();
+    printf("\n2. Time per sample, scalar path vs. block conversion\n");
+
+    std::vector<int16_t> raw(samples);
+    srand(1);
+    for(size_t i=0; i<samples; i++){
+        raw[i] = static_cast<int16_t>(rand());
+    }
+    std::vector<float> mV(samples);
+    std::vector<int32_t> uV(samples);
+    std::vector<int16_t> out(samples);
+    const ADS1115_RANGE range = ADS1115_RANGE_4096;
+    const uint16_t voltageRange = ADS1115_WE::rangeToMillivolts(range);
+
+    if(csv){
+        printf("conversion,batch_path,samples,scalar_ns_per_sample,batch_ns_per_sample,speedup\n");
+    }
+
+    double scalarNs = measure(samples, [&]{
+        for(size_t i=0; i<samples; i++){
+            mV[i] = scalarMilliVolts(raw[i], voltageRange);
+        }
+    });
+    double batchNs = measure(samples, [&]{
+        ADS1115_Convert::convertToMilliVolts(raw.data(), mV.data(), samples, range);
+    });
+    sink = static_cast<int64_t>(mV[samples / 2]);
+    printResult(csv, "milli_volts", samples, scalarNs, batchNs);
+
+    scalarNs = measure(samples, [&]{
+        for(size_t i=0; i<samples; i++){
+            uV[i] = scalarMicroVolts(raw[i], voltageRange);
+        }
+    });
+    batchNs = measure(samples, [&]{
+        ADS1115_Convert::convertToMicroVolts(raw.data(), uV.data(), samples, range);
+    });
+    sink = uV[samples / 2];
+    printResult(csv, "micro_volts", samples, scalarNs, batchNs);
+
+    scalarNs = measure(samples, [&]{
+        for(size_t i=0; i<samples; i++){
+            out[i] = scalarRange(raw[i], -1023, 1023);
+        }
+    });
+    batchNs = measure(samples, [&]{
+        ADS1115_Convert::convertToRange(raw.data(), out.data(), samples, -1023, 1023);
+    });
+    sink = out[samples / 2];
+    printResult(csv, "range", samples, scalarNs, batchNs);
+
+    printf("\n");
+    return checkSummary();
+}
@@ -0,0 +1,164 @@
+/******************************************************************************
+ *
+ * Checks the integer filters of ADS1115_Filter.h against reference calculations:
+ *
+ * 1. ADS1115_Median<N>: median of a sorted copy of the last N results (also
+ *    while fewer than N results were added), random data with duplicates and
+ *    the limits -32768 / 32767.
+ * 2. ADS1115_Decimator<FACTOR>: floor(sum / FACTOR + 0.5) for the powers of two
+ *    (shift) and the other factors (division), positive and negative sums up to
+ *    full scale.
+ * 3. ADS1115_EMA<SHIFT>: the first result initializes the average, steps up and
+ *    down settle exactly on the input, no overflow at full scale.
+ * 4. ADS1115_Filter / ADS1115_FilterBank: same outputs as the stages in a row.
+ *
+ * No simulation needed. Build: see extras/host/README.md. Returns 1 if a check
+ * failed.
+ *
+ ******************************************************************************/
+
+#include "Arduino.h"
+#include "ADS1115_Filter.h"
+#include "host_check.h"
+#include <algorithm>
+#include <math.h>
+#include <stdio.h>
+
+namespace
+{
+    uint32_t seed = 12345;
+
+    /* values from -32768 to 32767, often repeated and often at the limits */
+    int16_t randomRaw(){
+        seed = seed * 1664525UL + 1013904223UL;
+        switch((seed >> 8) & 7){
+            case 0:  return -32768;
+            case 1:  return 32767;
+            case 2:  return (int16_t)((seed >> 16) & 7);
+            default: return (int16_t)(seed >> 16);
+        }
+    }
+
+    template<uint8_t N>
+    void median(){
+        ADS1115_Median<N> filter;
+        int16_t window[N];
+        uint32_t wrong = 0;
+        for(uint32_t i=0; i<20000; i++){
+            if(i == 10000){
+                filter.reset();  // starts again with fewer than N results
+            }
+            uint32_t n = (i < 10000) ? i : i - 10000;
+            int16_t in = randomRaw();
+            window[n % N] = in;
+            uint8_t count = (n + 1 < N) ? n + 1 : N;
+            int16_t sorted[N];
+            std::copy(window, window + count, sorted);
+            std::sort(sorted, sorted + count);
+            wrong += filter.push(in) != sorted[(count - 1) / 2];
+        }
+        char text[48];
+        snprintf(text, sizeof(text), "Median<%u> equals the sorted window", N);
+        check(wrong == 0, text);
+    }
+
+    /* feeds FACTOR values with the sum s, for all sums near zero and near the limits,
+       every 97th sum in between */
+    template<uint16_t FACTOR>
+    void decimator(){
+        uint32_t wrong = 0;
+        uint32_t outputs = 0;
+        const int32_t lowest = -32768L * FACTOR;
+        const int32_t highest = 32767L * FACTOR;
+        for(int32_t s = lowest; s <= highest; s++){
+            ADS1115_Decimator<FACTOR> filter;
+            int32_t base = (s >= 0) ? s / (int32_t)FACTOR : -((-s + (int32_t)FACTOR - 1) / (int32_t)FACTOR);
+            int32_t rest = s - base * (int32_t)FACTOR;
+            int16_t out = 0;
+            bool ready = false;
+            for(uint16_t i=0; i<FACTOR; i++){
+                if(ready){
+                    wrong++;  // output before FACTOR results
+                }
+                ready = filter.push(base + ((int32_t)i < rest ? 1 : 0), out);
+            }
+            wrong += !ready || (out != (int32_t)floor((double)s / FACTOR + 0.5));
+            outputs++;
+            if((s > lowest + 300) && (s < highest - 300) && (labs(s) > 300)){
+                s += 97;
+            }
+        }
+        char text[64];
+        snprintf(text, sizeof(text), "Decimator<%u> rounds like floor(sum / %u + 0.5), %u sums", FACTOR, FACTOR, unsigned(outputs));
+        check(wrong == 0, text);
+    }
+
+    template<uint8_t SHIFT>
+    void ema(){
+        const int16_t steps[] = {1000, -1000, 32767, -32768, 32767, 0, -1, 1, -32768};
+        ADS1115_EMA<SHIFT> filter;
+        bool first = filter.push(1234) == 1234;
+        bool settled = true;
+        bool monotonic = true;
+        for(int16_t target : steps){
+            int16_t last = filter.read();
+            for(uint32_t i=0; i<(40UL << SHIFT); i++){
+                int16_t out = filter.push(target);
+                monotonic &= (target >= last) ? (out >= last && out <= target) : (out <= last && out >= target);
+                last = out;
+            }
+            settled &= last == target;
+        }
+        char text[64];
+        snprintf(text, sizeof(text), "EMA<%u>: initialized, monotonic steps, settles on the input", SHIFT);
+        check(first && settled && monotonic, text);
+    }
+
+    void filterChain(){
+        ADS1115_Filter<5, 4, 2> filter;
+        ADS1115_FilterBank<2, 5, 4, 2> bank;
+        ADS1115_Median<5> median;
+        ADS1115_Decimator<4> decimator;
+        ADS1115_EMA<2> ema;
+        ADS1115_Filter<1, 1, 0> bypass;
+        uint32_t wrong = 0;
+        uint32_t outputs = 0;
+        for(uint32_t i=0; i<10000; i++){
+            int16_t in = randomRaw();
+            int16_t val;
+            bool ready = decimator.push(median.push(in), val);
+            if(ready){
+                val = ema.push(val);
+                outputs++;
+            }
+            wrong += filter.push(in) != ready;
+            wrong += bank.push(1, in) != ready;
+            wrong += ready && ((filter.read() != val) || (bank.read(1) != val));
+            wrong += !bypass.push(in) || (bypass.read() != in);
+        }
+        wrong += bank.push(2, 0) || (bank.read(2) != 0);  // no such channel
+        char text[64];
+        snprintf(text, sizeof(text), "Filter<5, 4, 2> and FilterBank equal the stages, %u outputs", unsigned(outputs));
+        check(wrong == 0, text);
+    }
+}
+
+int main(){
+    median<1>();
+    median<3>();
+    median<5>();
+    median<15>();
+    decimator<1>();
+    decimator<2>();
+    decimator<3>();
+    decimator<4>();
+    decimator<6>();
+    decimator<10>();
+    decimator<16>();
+    ema<0>();
+    ema<1>();
+    ema<4>();
+    ema<15>();
+    filterChain();
+    return checkSummary();
+}
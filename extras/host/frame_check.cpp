@@ -0,0 +1,258 @@
+/******************************************************************************
+ *
+ * Checks ADS1115_FrameEncoder with the host decoder (ADS1115_FrameDecoder):
+ *
+ * 1. Round trip, raw and delta coded: samples, sources, sets, intervals and
+ *    timestamps (delta timestamps and key frames) are decoded unchanged, also
+ *    if the data is fed in small pieces.
+ * 2. Corrupted and lost bytes: the frame is dropped (CRC), the following frames
+ *    are decoded, the time is valid again after the next key frame.
+ * 3. Data rate of 4 channels at 860 SPS each, 16 sets per frame, compared to
+ *    the 11520 bytes/s of a 115200 baud link and to CSV text.
+ * 4. Scanner (4 channels of a simulated ADS1115) -> encoder -> decoder.
+ *
+ * Build: see extras/host/README.md. Returns 1 if a check failed.
+ *
+ ******************************************************************************/
+
+#include "Arduino.h"
+#include "Wire.h"
+#include "ADS1x15_Sim.h"
+#include "ADS1115_WE.h"
+#include "ADS1115_Scanner.h"
+#include "ADS1115_FrameEncoder.h"
+#include "ADS1115_FrameDecoder.h"
+#include "host_check.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+namespace
+{
+    const uint8_t CHANNELS = 4;
+    const uint8_t SETS_PER_FRAME = 16;
+    const uint32_t RATE = 860;
+    const uint32_t SERIAL_BYTES_PER_S = 115200 / 10; // 8N1
+
+    const uint8_t sources[CHANNELS] = {
+        ADS1115_FrameEncoder::source(ADS1115_COMP_0_GND, ADS1115_RANGE_4096),
+        ADS1115_FrameEncoder::source(ADS1115_COMP_1_GND, ADS1115_RANGE_4096),
+        ADS1115_FrameEncoder::source(ADS1115_COMP_0_1, ADS1115_RANGE_0256, 1),
+        ADS1115_FrameEncoder::source(ADS1115_COMP_3_GND, ADS1115_RANGE_6144, 3)
+    };
+
+    /* a slow signal with noise, a full scale square wave and the extreme values */
+    int16_t signal(uint32_t set, uint8_t channel){
+        switch(channel){
+            case 0:  return int16_t(12000 * sin(set * 0.01) + (rand() % 41) - 20);
+            case 1:  return (set / 7) % 2 ? 32767 : -32768;
+            case 2:  return int16_t((rand() % 201) - 100);
+            default: return int16_t(set * 37);
+        }
+    }
+
+    struct Stream {
+        std::vector<uint8_t> bytes;
+        std::vector<int16_t> samples;
+        std::vector<uint32_t> frameTimes;
+        size_t frames = 0;
+    };
+
+    /* encodes sets samples at RATE, all frames through a small buffer */
+    Stream encode(uint32_t sets, bool delta){
+        Stream s;
+        uint8_t buf[512];
+        ADS1115_FrameEncoder encoder(buf, sizeof(buf));
+        srand(1);
+        uint32_t t0 = 4294000000UL; // micros() overflows during the stream
+        for(uint32_t set=0; set<sets; set++){
+            uint32_t t = t0 + uint32_t(uint64_t(set) * 1000000 / RATE);
+            if((set % SETS_PER_FRAME) == 0){
+                encoder.beginFrame(sources, CHANNELS, t, delta);
+                s.frameTimes.push_back(t);
+            }
+            for(uint8_t ch=0; ch<CHANNELS; ch++){
+                int16_t val = signal(set, ch);
+                encoder.addSample(val);
+                s.samples.push_back(val);
+            }
+            if(((set + 1) % SETS_PER_FRAME) == 0 || (set + 1 == sets)){
+                encoder.endFrame(t);
+                s.frames++;
+                if(encoder.length() > (sizeof(buf) / 2)){
+                    s.bytes.insert(s.bytes.end(), encoder.data(), encoder.data() + encoder.length());
+                    encoder.clear();
+                }
+            }
+        }
+        s.bytes.insert(s.bytes.end(), encoder.data(), encoder.data() + encoder.length());
+        return s;
+    }
+
+    /* decodes in pieces of piece bytes, returns the number of wrong values */
+    uint32_t decode(const Stream &s, size_t piece, ADS1115_FrameDecoder &decoder, bool checkTime = true){
+        uint32_t wrong = 0;
+        size_t sample = 0;
+        size_t frame = 0;
+        ADS1115_Frame f;
+        for(size_t pos=0; pos<s.bytes.size(); pos+=piece){
+            decoder.feed(&s.bytes[pos], std::min(piece, s.bytes.size() - pos));
+            while(decoder.next(f)){
+                if((f.channels() != CHANNELS) || (f.sources[2] != sources[2])){
+                    wrong++;
+                }
+                if(checkTime && (!f.timeValid || (f.timestamp_us != s.frameTimes[frame]))){
+                    wrong++;
+                }
+                if((f.sets > 1) && (abs(int(f.interval_us) - int(1000000 / RATE)) > 1)){
+                    wrong++;
+                }
+                for(size_t i=0; i<f.samples.size(); i++, sample++){
+                    if((sample >= s.samples.size()) || (f.samples[i] != s.samples[sample])){
+                        wrong++;
+                    }
+                }
+                frame++;
+            }
+        }
+        return wrong + (sample != s.samples.size()) + (frame != s.frames);
+    }
+
+    void roundTrip(){
+        printf("Round trip:\n");
+        for(int delta=0; delta<2; delta++){
+            Stream s = encode(1000, delta);
+            ADS1115_FrameDecoder whole, pieces;
+            uint32_t wrong = decode(s, s.bytes.size(), whole);
+            wrong += decode(s, 3, pieces);
+            printf("  %s: %u samples in %u frames, %u bytes (%.2f bytes per sample)\n", delta ? "delta" : "raw  ",
+                   unsigned(s.samples.size()), unsigned(s.frames), unsigned(s.bytes.size()),
+                   double(s.bytes.size()) / s.samples.size());
+            check(wrong == 0, delta ? "delta coded frames decoded unchanged" : "raw frames decoded unchanged");
+            check(whole.getCrcErrors() + pieces.getCrcErrors() + whole.getSkippedBytes() == 0, "no CRC errors");
+        }
+        check(ADS1115_Frame::mux(sources[2]) == (ADS1115_COMP_0_1 >> 12) &&
+              ADS1115_Frame::range(sources[2]) == (ADS1115_RANGE_0256 >> 9) && ADS1115_Frame::device(sources[3]) == 3,
+              "source bytes");
+    }
+
+    void corruption(){
+        printf("Corrupted and lost data:\n");
+        Stream s = encode(SETS_PER_FRAME * 40, true);
+        size_t frameLen = s.bytes.size() / s.frames; // roughly
+        std::vector<uint8_t> bad = s.bytes;
+        bad[frameLen * 3 + frameLen / 2] ^= 0x10;                            // one bit in frame 3
+        bad.erase(bad.begin() + frameLen * 20, bad.begin() + frameLen * 20 + 5); // lost bytes in frame 20
+        ADS1115_FrameDecoder decoder;
+        decoder.feed(bad.data(), bad.size());
+        ADS1115_Frame f;
+        uint32_t frames = 0, timeInvalid = 0, wrongTime = 0;
+        while(decoder.next(f)){
+            frames++;
+            if(!f.timeValid){
+                timeInvalid++;
+                continue;
+            }
+            bool found = false;
+            for(uint32_t t : s.frameTimes){
+                found |= (t == f.timestamp_us);
+            }
+            wrongTime += !found;
+        }
+        printf("  %u of %u frames decoded, %u CRC errors, %u bytes skipped, %u frames without time\n", frames,
+               unsigned(s.frames), decoder.getCrcErrors(), decoder.getSkippedBytes(), timeInvalid);
+        check((frames >= s.frames - 3) && (frames <= s.frames - 2), "only the damaged frames are lost");
+        check(decoder.getCrcErrors() >= 2, "CRC errors detected");
+        check(wrongTime == 0, "valid timestamps are correct");
+        check((timeInvalid > 0) && (timeInvalid < 32), "time valid again after the next key frame");
+    }
+
+    void dataRate(){
+        printf("Data rate, %u channels at %u SPS each, %u sets per frame:\n", CHANNELS, unsigned(RATE), SETS_PER_FRAME);
+        for(int delta=0; delta<2; delta++){
+            Stream s = encode(RATE * 10, delta);
+            double bytesPerS = s.bytes.size() / 10.0;
+            printf("  %s: %.0f bytes/s (%.0f %% of 115200 baud)\n", delta ? "delta" : "raw  ", bytesPerS,
+                   100.0 * bytesPerS / SERIAL_BYTES_PER_S);
+            check(bytesPerS < SERIAL_BYTES_PER_S, "fits through 115200 baud");
+        }
+        /* the same as text, e.g. "-12345,32767,-100,4096\r\n" */
+        Stream s = encode(RATE * 10, false);
+        size_t textBytes = 0;
+        for(size_t i=0; i<s.samples.size(); i++){
+            textBytes += snprintf(nullptr, 0, "%d", s.samples[i]) + (((i % CHANNELS) == CHANNELS - 1) ? 2 : 1);
+        }
+        printf("  text: %.0f bytes/s (%.0f %% of 115200 baud)\n", textBytes / 10.0,
+               100.0 * textBytes / 10.0 / SERIAL_BYTES_PER_S);
+    }
+
+    void scanner(){
+        printf("Scanner -> encoder -> decoder (simulated ADS1115, 4 channels, 860 SPS):\n");
+        ArduinoHost::reset();
+        ADS1x15_Sim sim(ADS1x15_Sim::SIM_ADS1115, 0x48);
+        for(uint8_t i=0; i<4; i++){
+            sim.setInput(i, ADS1x15_Sim::sine(0.5 + i * 0.5, 2.0 + i, 2.5));
+        }
+        sim.connect(Wire);
+        Wire.setClock(400000);
+        ADS1115_WE adc(0x48);
+        adc.init();
+        adc.setVoltageRange_mV(ADS1115_RANGE_6144);
+        adc.setConvRate(ADS1115_860_SPS);
+        ADS1115_Scanner scan(adc);
+        const ADS1115_MUX muxes[4] = {ADS1115_COMP_0_GND, ADS1115_COMP_1_GND, ADS1115_COMP_2_GND, ADS1115_COMP_3_GND};
+        uint8_t src[4];
+        for(uint8_t i=0; i<4; i++){
+            src[i] = ADS1115_FrameEncoder::source(muxes[i], ADS1115_RANGE_6144);
+        }
+        scan.begin(muxes, 4);
+
+        uint8_t buf[160];
+        ADS1115_FrameEncoder encoder(buf, sizeof(buf));
+        ADS1115_FrameDecoder decoder;
+        std::vector<int16_t> sent;
+        uint32_t wrong = 0;
+        size_t received = 0;
+        size_t bytes = 0;
+        uint8_t sets = 0;
+        while(millis() < 2000){
+            if(!scan.update()){
+                delayMicroseconds(100);
+                continue;
+            }
+            if(sets == 0){
+                encoder.beginFrame(src, 4, micros());
+            }
+            for(uint8_t i=0; i<4; i++){
+                sent.push_back(scan.getRawResult(i));
+                encoder.addSample(sent.back());
+            }
+            if(++sets == SETS_PER_FRAME){
+                encoder.endFrame(micros());
+                decoder.feed(encoder.data(), encoder.length()); // Serial.write(...)
+                bytes += encoder.length();
+                encoder.clear();
+                sets = 0;
+                ADS1115_Frame f;
+                while(decoder.next(f)){
+                    for(int16_t v : f.samples){
+                        wrong += (received >= sent.size()) || (v != sent[received]);
+                        received++;
+                    }
+                }
+            }
+        }
+        printf("  %u sets, %u bytes in 2 s\n", unsigned(received / 4), unsigned(bytes));
+        check((received > 0) && (wrong == 0), "samples received unchanged");
+        sim.disconnect();
+    }
+}
+
+int main(){
+    roundTrip();
+    corruption();
+    dataRate();
+    scanner();
+    return checkSummary();
+}
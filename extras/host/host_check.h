@@ -0,0 +1,32 @@
+/******************************************************************************
+ *
+ * Fixture of the host check programs: check() prints one result line and
+ * counts the failed checks, checkSummary() prints the total and returns the
+ * exit code (1 if a check failed). Each check program is one translation unit,
+ * so the counter is file local.
+ *
+ ******************************************************************************/
+
+#ifndef HOST_CHECK_H_
+#define HOST_CHECK_H_
+
+#include <stdio.h>
+
+namespace
+{
+    int failures = 0;
+
+    void check(bool condition, const char *text){
+        printf("  %s: %s\n", condition ? "ok    " : "FAILED", text);
+        if(!condition){
+            failures++;
+        }
+    }
+
+    int checkSummary(){
+        printf(failures ? "%d check(s) failed\n" : "all checks passed\n", failures);
+        return failures ? 1 : 0;
+    }
+}
+
+#endif
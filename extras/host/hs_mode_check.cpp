@@ -0,0 +1,134 @@
+/******************************************************************************
+ *
+ * Checks the Hs-mode session of ADS1115_WE against the framing checks of the
+ * host bus (see Wire.h) and compares readBlock() of an ADS1015 at 3300 SPS at
+ * 400 kHz and in Hs-mode (3.4 MHz):
+ *
+ * 1. A session sends one master code at 400 kHz, then all transfers are in
+ *    Hs-mode without STOP. endHsSession() leaves the Hs-mode and restores the
+ *    clock. No framing errors.
+ * 2. A core which sends a STOP after the NACKed master code: beginHsSession()
+ *    returns false, the clock is 400 kHz again and the results are correct.
+ * 3. Negative test: 3.4 MHz without master code causes framing errors.
+ *
+ * Build: see extras/host/README.md. Returns 1 if a check failed.
+ *
+ ******************************************************************************/
+
+#include "Arduino.h"
+#include "Wire.h"
+#include "ADS1x15_Sim.h"
+#include "ADS1115_WE.h"
+#include "host_check.h"
+#include <stdio.h>
+
+namespace
+{
+    const uint32_t SAMPLES = 1000;
+
+    /* ADS1015 at 0x48, AIN0 = 1 V, ALERT/RDY at pin 2 */
+    struct Setup {
+        ADS1x15_Sim sim{ADS1x15_Sim::SIM_ADS1015, 0x48};
+        ADS1115_WE adc{0x48};
+
+        Setup(bool stopAfterNack){
+            ArduinoHost::reset();
+            sim.setInputVoltage(0, 1.0);
+            sim.setAlertPin(2);
+            sim.connect(Wire);
+            Wire.setClock(400000);
+            Wire.setStopAfterNack(stopAfterNack);
+            pinMode(2, INPUT_PULLUP);
+            adc.init(true);
+            adc.setVoltageRange_mV(ADS1015_RANGE_2048);
+            adc.setConvRate(ADS1015_3300_SPS);
+            adc.setCompareChannels(ADS1015_COMP_0_GND);
+            adc.setReadyPin(2);
+            Wire.resetStats();
+        }
+
+        ~Setup(){
+            sim.disconnect();
+            Wire.setStopAfterNack(false);
+        }
+
+        /* returns the number of wrong results */
+        uint32_t readBlock(uint32_t &missed, double &busUsPerSample){
+            static int16_t buf[SAMPLES];
+            uint64_t busStart = Wire.stats().busTimeNs;
+            size_t n = adc.readBlock(buf, SAMPLES);
+            busUsPerSample = (Wire.stats().busTimeNs - busStart) * 1e-3 / SAMPLES;
+            missed = adc.getMissedConversions();
+            uint32_t wrong = SAMPLES - n;
+            for(size_t i=0; i<n; i++){
+                if(abs(buf[i] - 16000) > 16){ // 1 V in the 2048 mV range, 12 bit left justified
+                    wrong++;
+                }
+            }
+            return wrong;
+        }
+    };
+
+    void fsMode(){
+        printf("readBlock(), ADS1015 at 3300 SPS, 400 kHz:\n");
+        Setup s(false);
+        uint32_t missed;
+        double busUsPerSample;
+        uint32_t wrong = s.readBlock(missed, busUsPerSample);
+        printf("  bus time %.1f us per sample (%.0f %% of the conversion period), %u missed conversions\n",
+               busUsPerSample, busUsPerSample / 3.03, missed);
+        check(wrong == 0, "results correct");
+    }
+
+    void hsSession(){
+        printf("readBlock(), ADS1015 at 3300 SPS, Hs-mode session (3.4 MHz):\n");
+        Setup s(false);
+        uint32_t missed;
+        double busUsPerSample;
+        check(s.adc.beginHsSession(3400000, 400000), "beginHsSession() returns true");
+        check(Wire.isHsMode() && (Wire.getClock() == 3400000), "bus in Hs-mode at 3.4 MHz");
+        uint32_t wrong = s.readBlock(missed, busUsPerSample);
+        printf("  bus time %.1f us per sample (%.0f %% of the conversion period), %u missed conversions\n",
+               busUsPerSample, busUsPerSample / 3.03, missed);
+        check(wrong == 0, "results correct");
+        check(Wire.isHsMode(), "still in Hs-mode after readBlock() (no STOP)");
+        s.adc.endHsSession();
+        check(!Wire.isHsMode() && (Wire.getClock() == 400000), "endHsSession(): STOP sent, 400 kHz restored");
+        check(!s.adc.isDisconnected(), "device answers after the session");
+        const I2CBusStats &st = Wire.stats();
+        printf("  master codes: %u, Hs transfers: %u of %u, framing errors: %u\n", st.hsEntries, st.hsTransfers,
+               st.transactions, st.framingErrors);
+        check(st.hsEntries == 1, "one master code");
+        check(st.framingErrors == 0, "no framing errors");
+    }
+
+    void fallback(){
+        printf("Core which sends a STOP after a NACK:\n");
+        Setup s(true);
+        uint32_t missed;
+        double busUsPerSample;
+        check(!s.adc.beginHsSession(3400000, 400000), "beginHsSession() returns false");
+        check(!s.adc.isHsSession() && !Wire.isHsMode() && (Wire.getClock() == 400000), "back at 400 kHz");
+        Wire.resetStats();
+        uint32_t wrong = s.readBlock(missed, busUsPerSample);
+        check(wrong == 0, "results correct");
+        check(Wire.stats().framingErrors == 0, "no framing errors after the fallback");
+    }
+
+    void noMasterCode(){
+        printf("3.4 MHz without master code (negative test):\n");
+        Setup s(false);
+        Wire.setClock(3400000);
+        s.adc.getRawResult();
+        check(Wire.stats().framingErrors > 0, "framing error detected");
+        Wire.setClock(400000);
+    }
+}
+
+int main(){
+    fsMode();
+    hsSession();
+    fallback();
+    noMasterCode();
+    return checkSummary();
+}
@@ -0,0 +1,39 @@
+#!/usr/bin/env python3
+"""Turns an Arduino sketch into a C++ file for the host build.
+
+Like the Arduino builder, it includes Arduino.h and adds prototypes for all
+functions defined in the sketch, so they can be used before their definition.
+
+Usage: ino2cpp.py sketch.ino > sketch.cpp
+"""
+import re
+import sys
+
+FUNC = re.compile(r'^([A-Za-z_][\w<>:\*&\s]*?[\s\*&])([A-Za-z_]\w*)\s*\(([^;{}]*)\)\s*\{?\s*(//.*)?$')
+KEYWORDS = {'if', 'for', 'while', 'switch', 'return', 'else', 'do'}
+
+def main():
+    path = sys.argv[1]
+    with open(path) as f:
+        lines = f.read().splitlines()
+    prototypes = []
+    first = None
+    for i, line in enumerate(lines):
+        m = FUNC.match(line)
+        if m and m.group(2) not in KEYWORDS and not m.group(1).strip().startswith(('return', 'else')):
+            prototypes.append('%s%s(%s);' % (m.group(1), m.group(2), m.group(3)))
+            if first is None:
+                first = i
+    if first is None:
+        first = len(lines)
+    # like the Arduino builder: prototypes go in front of the first function
+    print('#include "Arduino.h"')
+    print('#line 1 "%s"' % path)
+    print('\n'.join(lines[:first]))
+    for p in prototypes:
+        print(p)
+    print('#line %d "%s"' % (first + 1, path))
+    print('\n'.join(lines[first:]))
+
+if __name__ == '__main__':
+    main()
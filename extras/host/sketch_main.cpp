@@ -0,0 +1,45 @@
+/******************************************************************************
+ *
+ * Runs an Arduino sketch on the Linux host against simulated ADS1115s (or
+ * ADS1015s) at the addresses 0x48 to 0x4B on Wire. ALERT/RDY of the device at
+ * 0x48 is connected to pin 2.
+ * AIN0 = 1 V, AIN1 = 2 V, AIN2 = 3 V (constant), AIN3 = 0.5 Hz sine 2.5 V +/- 2 V.
+ * The devices at 0x49 to 0x4B deliver the same plus 0.1 V, 0.2 V and 0.3 V.
+ *
+ * Usage: ./sketch [virtual seconds, default 10] [ads1015]
+ *
+ ******************************************************************************/
+
+#include "Arduino.h"
+#include "Wire.h"
+#include "ADS1x15_Sim.h"
+
+void setup();
+void loop();
+
+int main(int argc, char **argv){
+    unsigned long seconds = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 10;
+    bool ads1015 = (argc > 2) && (strcmp(argv[2], "ads1015") == 0);
+
+    ADS1x15_Sim::simChip chip = ads1015 ? ADS1x15_Sim::SIM_ADS1015 : ADS1x15_Sim::SIM_ADS1115;
+    ADS1x15_Sim sims[4] = {{chip, 0x48}, {chip, 0x49}, {chip, 0x4A}, {chip, 0x4B}};
+    for(int i=0; i<4; i++){
+        double offset = 0.1 * i;
+        sims[i].setInputVoltage(0, 1.0 + offset);
+        sims[i].setInputVoltage(1, 2.0 + offset);
+        sims[i].setInputVoltage(2, 3.0 + offset);
+        sims[i].setInput(3, ADS1x15_Sim::sine(2.0, 0.5, 2.5 + offset));
+        sims[i].connect(Wire);
+    }
+    sims[0].setAlertPin(2);
+
+    setup();
+    while(ArduinoHost::nowNs() < seconds * 1000000000ULL){
+        uint64_t before = ArduinoHost::nowNs();
+        loop();
+        if(ArduinoHost::nowNs() == before){
+            yield(); // loop() without any delay or bus access
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,115 @@
+/******************************************************************************
+ *
+ * Checks ADS1115_Statistics against reference calculations in double:
+ *
+ * 1. Empty statistics, count, minimum and maximum, snapshotAndReset().
+ * 2. Random results of mixed ranges: mean, standard deviation and RMS.
+ * 3. Constant and alternating series with the exact mean and deviation.
+ * 4. The limit of the header: 29 million results at full scale in the
+ *    6144 mV range (mean -6144 mV, deviation 0). Build with
+ *    -fsanitize=undefined to see that no signed overflow occurs on the way.
+ *
+ * No simulation needed. Build: see extras/host/README.md. Returns 1 if a check
+ * failed.
+ *
+ ******************************************************************************/
+
+#include "Arduino.h"
+#include "ADS1115_Statistics.h"
+#include "host_check.h"
+#include <math.h>
+#include <stdio.h>
+
+namespace
+{
+    const ADS1115_RANGE ranges[] = {ADS1115_RANGE_6144, ADS1115_RANGE_4096, ADS1115_RANGE_2048,
+                                    ADS1115_RANGE_1024, ADS1115_RANGE_0512, ADS1115_RANGE_0256};
+    const double LSB_MV = 1.0 / 128.0;  // unit of the accumulators, one LSB in the 256 mV range
+
+    uint32_t seed = 4711;
+
+    uint32_t nextRandom(){
+        seed = seed * 1664525UL + 1013904223UL;
+        return seed;
+    }
+
+    bool near(double value, double ref, double tolerance){
+        return fabs(value - ref) <= tolerance * (1.0 + fabs(ref));
+    }
+
+    void basics(){
+        ADS1115_Statistics stats;
+        ADS1115_ChannelStats s = stats.snapshot();
+        check((s.count == 0) && (s.mean_mV == 0.0) && (s.stdDev_mV == 0.0), "empty snapshot");
+
+        stats.add(-100, ADS1115_RANGE_2048);   // -6.25 mV
+        stats.add(400, ADS1115_RANGE_0256);    // 3.125 mV
+        stats.add(ADS1115_Sample{0, ADS1115_RANGE_6144});
+        s = stats.snapshotAndReset();
+        check((s.count == 3) && (stats.getCount() == 0), "count and snapshotAndReset()");
+        check((s.min_mV == -6.25f) && (s.max_mV == 3.125f), "minimum and maximum of mixed ranges");
+
+        stats.add(5, ADS1115_RANGE_6144);
+        s = stats.snapshot();
+        check((s.count == 1) && (s.min_mV == s.max_mV) && (s.stdDev_mV == 0.0), "one result after reset");
+    }
+
+    void randomSeries(){
+        ADS1115_Statistics stats;
+        double sum = 0.0;
+        double sumSq = 0.0;
+        const uint32_t n = 100000;
+        for(uint32_t i=0; i<n; i++){
+            int16_t raw = (int16_t)(nextRandom() >> 16);
+            ADS1115_RANGE range = ranges[(nextRandom() >> 16) % 6];
+            stats.add(raw, range);
+            double mV = raw * ADS1115_WE::rangeFactor(range) * LSB_MV;
+            sum += mV;
+            sumSq += mV * mV;
+        }
+        double mean = sum / n;
+        ADS1115_ChannelStats s = stats.snapshot();
+        check(near(s.mean_mV, mean, 1e-5), "random mixed ranges: mean");
+        check(near(s.stdDev_mV, sqrt(sumSq / n - mean * mean), 1e-5), "random mixed ranges: standard deviation");
+        check(near(s.rms_mV, sqrt(sumSq / n), 1e-5), "random mixed ranges: RMS");
+    }
+
+    void exactSeries(){
+        ADS1115_Statistics stats;
+        for(int i=0; i<1000; i++){
+            stats.add((i % 2) ? 1000 : -3000, ADS1115_RANGE_2048);
+        }
+        ADS1115_ChannelStats s = stats.snapshot();
+        printf("  alternating: mean %.4f mV (-62.5), deviation %.4f mV (125)\n", s.mean_mV, s.stdDev_mV);
+        check(near(s.mean_mV, -62.5, 1e-6) && near(s.stdDev_mV, 125.0, 1e-6), "alternating series: exact mean and deviation");
+
+        stats.reset();
+        for(int i=0; i<1000; i++){
+            stats.add(12345, ADS1115_RANGE_4096);
+        }
+        s = stats.snapshot();
+        check(near(s.mean_mV, 12345 * 0.125, 1e-6) && (s.stdDev_mV == 0.0), "constant series: deviation 0");
+    }
+
+    void fullScale(){
+        ADS1115_Statistics stats;
+        const uint32_t n = 29000000;
+        volatile int16_t raw = -32768;  // keeps the compiler from folding the loop
+        for(uint32_t i=0; i<n; i++){
+            stats.add(raw, ADS1115_RANGE_6144);
+        }
+        ADS1115_ChannelStats s = stats.snapshot();
+        printf("  %u results at -32768: mean %.3f mV, deviation %.6f mV, RMS %.3f mV\n",
+               unsigned(s.count), s.mean_mV, s.stdDev_mV, s.rms_mV);
+        check((s.count == n) && near(s.mean_mV, -6144.0, 1e-6) && (s.stdDev_mV < 0.01) && near(s.rms_mV, 6144.0, 1e-6),
+              "29 million full-scale results (limit of the header)");
+    }
+}
+
+int main(){
+    basics();
+    randomSeries();
+    exactSeries();
+    fullScale();
+    return checkSummary();
+}
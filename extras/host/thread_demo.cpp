@@ -0,0 +1,195 @@
+/******************************************************************************
+ *
+ * Multi-threaded test of the bus lock, ADS1115_SharedSamples and
+ * ADS1115_AcquisitionTask with std::thread:
+ *
+ * 1. One writer publishes sets in which every entry holds the set number, four
+ *    readers check that they never get a mixed set.
+ * 2. An acquisition thread owns the simulated ADS1115 at 0x48 and publishes
+ *    four channels, a second thread uses the ADS1115 at 0x49 on the same bus,
+ *    two reader threads only read the shared samples. The bus counts transfers
+ *    which break into a transaction of another thread.
+ *
+ * Usage: ./thread_demo [--no-lock]
+ *   --no-lock  runs part 2 without bus lock to show the interleaved transfers
+ *
+ * Build: see extras/host/README.md. Returns 1 if a check failed.
+ *
+ ******************************************************************************/
+
+#include "Arduino.h"
+#include "Wire.h"
+#include "ADS1x15_Sim.h"
+#include "ADS1115_WE.h"
+#include "ADS1115_AcquisitionTask.h"
+#include <stdio.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    std::recursive_mutex busMutex;
+
+    void lockBus(void *){
+        busMutex.lock();
+    }
+
+    void unlockBus(void *){
+        busMutex.unlock();
+    }
+
+    int16_t expectedRaw(double volts){
+        return static_cast<int16_t>(volts / 4.096 * 32768.0 + 0.5);
+    }
+
+    bool near(int16_t raw, int16_t expected){
+        return abs(raw - expected) <= 2;
+    }
+
+    /* Part 1: torn sets */
+    bool boardTest(){
+        const uint32_t SETS = 200000;
+        ADS1115_SharedSamples<8> board;
+        std::atomic<bool> done(false);
+        std::atomic<uint32_t> torn(0), reads(0), backwards(0);
+
+        std::vector<std::thread> readers;
+        for(int r=0; r<4; r++){
+            readers.emplace_back([&](){
+                ADS1115_Sample samples[8];
+                uint32_t last = 0;
+                while(!done){
+                    uint32_t set = board.read(samples, 8);
+                    reads++;
+                    if(set < last){
+                        backwards++;
+                    }
+                    last = set;
+                    for(int i=0; i<8; i++){
+                        if((samples[i].raw != static_cast<int16_t>(set))
+                                || (samples[i].range != static_cast<ADS1115_RANGE>((set % 6) << 9))){
+                            torn++;
+                            break;
+                        }
+                    }
+                }
+            });
+        }
+        std::thread writer([&](){
+            ADS1115_Sample samples[8];
+            for(uint32_t set=1; set<=SETS; set++){
+                for(int i=0; i<8; i++){
+                    samples[i].raw = static_cast<int16_t>(set);
+                    samples[i].range = static_cast<ADS1115_RANGE>((set % 6) << 9);
+                }
+                board.publish(samples, 8, set);
+            }
+            done = true;
+        });
+        writer.join();
+        for(std::thread &t : readers){
+            t.join();
+        }
+        printf("shared samples: %u sets published, %u reads, %u torn, %u out of order\n",
+               board.getSetCount(), reads.load(), torn.load(), backwards.load());
+        return (board.getSetCount() == SETS) && (torn == 0) && (backwards == 0);
+    }
+
+    /* Part 2: acquisition task and a second device on the same bus */
+    bool acquisitionTest(bool useLock){
+        const uint32_t SETS = 200;
+        const uint32_t POLLS = 200;
+        const double volts[4] = {0.5, 1.0, 1.5, 2.0};
+        ArduinoHost::reset();
+        ADS1x15_Sim sim48(ADS1x15_Sim::SIM_ADS1115, 0x48);
+        ADS1x15_Sim sim49(ADS1x15_Sim::SIM_ADS1115, 0x49);
+        for(int i=0; i<4; i++){
+            sim48.setInputVoltage(i, volts[i]);
+            sim49.setInputVoltage(i, volts[i] + 0.1);
+        }
+        sim48.connect(Wire);
+        sim49.connect(Wire);
+        Wire.setClock(400000);
+        Wire.resetStats();
+
+        ADS1115_WE adc48(0x48), adc49(0x49);
+        for(ADS1115_WE *adc : {&adc48, &adc49}){
+            if(useLock){
+                adc->setBusLock(lockBus, unlockBus);
+            }
+            adc->init();
+            adc->setVoltageRange_mV(ADS1115_RANGE_4096);
+            adc->setConvRate(ADS1115_860_SPS);
+        }
+
+        static const ADS1115_MUX channels[4] = {ADS1115_COMP_0_GND, ADS1115_COMP_1_GND,
+                                                ADS1115_COMP_2_GND, ADS1115_COMP_3_GND};
+        ADS1115_SharedSamples<4> latest;
+        ADS1115_AcquisitionTask acquisition(adc48, latest);
+        acquisition.begin(channels, 4);
+
+        std::atomic<bool> done(false);
+        std::atomic<uint32_t> wrong48(0), wrong49(0), reads(0), polls(0);
+
+        std::thread acquisitionThread([&](){ acquisition.run(); });
+        std::thread pollThread([&](){
+            while(!done){
+                adc49.startSingleMeasurement(ADS1115_COMP_0_GND);
+                adc49.waitForConversion();
+                if(!near(adc49.getRawResult(), expectedRaw(volts[0] + 0.1))){
+                    wrong49++;
+                }
+                polls++;
+            }
+        });
+        std::vector<std::thread> readers;
+        for(int r=0; r<2; r++){
+            readers.emplace_back([&](){
+                ADS1115_Sample samples[4];
+                while(!done){
+                    std::this_thread::yield();
+                    if(!latest.read(samples, 4)){
+                        continue;
+                    }
+                    reads++;
+                    for(int i=0; i<4; i++){
+                        if(!near(samples[i].raw, expectedRaw(volts[i])) || (samples[i].range != ADS1115_RANGE_4096)){
+                            wrong48++;
+                            break;
+                        }
+                    }
+                }
+            });
+        }
+        while((latest.getSetCount() < SETS) || (polls < POLLS)){
+            std::this_thread::yield();
+        }
+        done = true;
+        acquisition.stop();
+        acquisitionThread.join();
+        pollThread.join();
+        for(std::thread &t : readers){
+            t.join();
+        }
+        sim48.disconnect();
+        sim49.disconnect();
+
+        printf("acquisition (%s): %u sets, %u reads with %u wrong sets, %u polls of 0x49 with %u wrong, "
+               "%u interleaved transfers, %u timeouts\n", useLock ? "bus lock" : "no bus lock",
+               latest.getSetCount(), reads.load(), wrong48.load(), polls.load(), wrong49.load(),
+               Wire.stats().interleaved, acquisition.getTimeouts());
+        return (wrong48 == 0) && (wrong49 == 0) && (Wire.stats().interleaved == 0);
+    }
+}
+
+int main(int argc, char **argv){
+    bool useLock = !((argc > 1) && (strcmp(argv[1], "--no-lock") == 0));
+    bool ok = boardTest();
+    bool acqOk = acquisitionTest(useLock);
+    if(useLock){
+        ok = ok && acqOk;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,33 @@
+#!/bin/sh
+# Builds every example sketch with PlatformIO for one board, with the default and with the 
+# tiny profile (-DADS1115_TINY, see src/ADS1115_config.h), and prints the flash and RAM usage 
+# as markdown table. Sketches which need other libraries, another board or removed features 
+# are marked with "-".
+#
+# usage: extras/size_report.sh [board] > size_report.md    (default board: uno)
+
+BOARD=${1:-uno}
+cd "$(dirname "$0")/.." || exit 1
+
+used() {
+    # "RAM:   [=  ]   9.7% (used 199 bytes from 2048 bytes)" -> 199
+    grep "^$1:" | sed -n 's/.*used \([0-9]*\) bytes.*/\1/p'
+}
+
+build() {
+    pio ci --lib="." --board="$BOARD" --project-option="build_flags=$2" "$1" 2>/dev/null > /tmp/size_report_build.txt
+    if [ $? -eq 0 ]; then
+        echo "$(used Flash < /tmp/size_report_build.txt) | $(used RAM < /tmp/size_report_build.txt)"
+    else
+        echo "- | -"
+    fi
+}
+
+echo "Board: $BOARD"
+echo
+echo "| Sketch | Flash | RAM | Flash (tiny) | RAM (tiny) |"
+echo "|--------|------:|----:|-------------:|-----------:|"
+for sketch in examples/*/*.ino; do
+    name=$(basename "$sketch" .ino)
+    echo "| $name | $(build "$sketch" "") | $(build "$sketch" "-DADS1115_TINY") |"
+done
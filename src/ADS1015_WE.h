@@ -26,9 +26,47 @@
 #include <Arduino.h>
 #endif
 
+/* The ADS1115_WE functions work for both chips, the results are in the format of the conversion 
+ * register (12 bit result * 16). The ADS1015_WE object selects the ADS1015 timing from the start 
+ * and adds functions for the native 12 bit results. 
+ */
 class ADS1015_WE : public ADS1115_WE {
     public:
-        using ADS1115_WE::ADS1115_WE;               
+        typedef ADS1x15_ChipTraits<ADS1015_CHIP> Traits;
+
+#ifndef USE_TINY_WIRE_M_
+        ADS1015_WE(const uint8_t addr = 0x48) : ADS1115_WE(addr) { selectChip(ADS1015_CHIP); }
+        ADS1015_WE(TwoWire *w, const uint8_t addr = 0x48) : ADS1115_WE(w, addr) { selectChip(ADS1015_CHIP); }
+#else
+        ADS1015_WE(const uint8_t addr = 0x48) : ADS1115_WE(addr) { selectChip(ADS1015_CHIP); }
+#endif
+
+        /* init(false) switches to the ADS1115 timing, e.g. for a module which is sold as ADS1015 
+         * but carries an ADS1115 (see the README) */
+        bool init(bool ads1015 = true){
+            return ADS1115_WE::init(ads1015);
+        }
+
+        /* Native 12 bit results: -2048...2047, one LSB is rangeFactor(range) * 125 µV, e.g. 
+         * 3 mV in the 6144 mV range 
+         */
+        int16_t getRawResult_12bit(){
+            return Traits::toResult(getRawResult());
+        }
+
+        /* readBlock() with native 12 bit results */
+        size_t readBlock_12bit(int16_t *buf, size_t n, uint32_t *timestamps = nullptr){
+            size_t count = readBlock(buf, n, timestamps);
+            for(size_t i=0; i<count; i++){
+                buf[i] = Traits::toResult(buf[i]);
+            }
+            return count;
+        }
+
+        /* Native 12 bit result -> microvolts (exact) */
+        static constexpr int32_t resultToMicrovolts(int16_t result, ADS1115_RANGE range){
+            return Traits::resultToMicrovolts(result, rangeFactor(range));
+        }
 };
 
 #endif
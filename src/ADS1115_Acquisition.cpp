@@ -0,0 +1,120 @@
+/*****************************************
+* This is a library for the ADS1115 and ADS1015 A/D Converter
+*
+* You'll find an example which should enable you to use the library.
+*
+* You are free to use it, change it or build on it. In case you like
+* it, it would be cool if you give it a star.
+*
+* If you find bugs, please inform me!
+*
+* Written by Wolfgang (Wolle) Ewald
+* https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+* https://wolles-elektronikkiste.de/ads1115 (German)
+*
+*******************************************/
+
+#include "ADS1115_Acquisition.h"
+
+void ADS1115_Acquisition::begin(bool readISR){
+    readInISR = readISR;
+    pendingConversions = 0;
+    buffer.clear();
+    adc.beginConfig();
+    adc.setAlertPinMode(ADS1115_ASSERT_AFTER_1);
+    adc.setAlertPinToConversionReady();
+    adc.setMeasureMode(ADS1115_CONTINUOUS);
+    adc.commitConfig();
+}
+
+void ADS1115_Acquisition::end(){
+    adc.beginConfig();
+    adc.setMeasureMode(ADS1115_SINGLE);
+    adc.setAlertPinMode(ADS1115_DISABLE_ALERT);
+    adc.commitConfig();
+    pendingConversions = 0;
+}
+
+void ADS1115_Acquisition::onConversionReady(){
+    if(readInISR){
+        store(adc.getRawResultInISR());
+    }
+    else if(pendingConversions < 255){
+        pendingConversions++;
+    }
+}
+
+void ADS1115_Acquisition::service(){
+    if(readInISR || !pendingConversions){
+        return;
+    }
+    /* the ISR may increment the counter while we are here, so take it atomically */
+    noInterrupts();
+    uint8_t pending = pendingConversions;
+    pendingConversions = 0;
+    interrupts();
+
+    /* the conversion register only holds the latest result */
+    missedConversions += pending - 1;
+    store(adc.getRawResult());
+}
+
+uint16_t ADS1115_Acquisition::available(){
+    return buffer.available();
+}
+
+bool ADS1115_Acquisition::read(int16_t &sample){
+    return buffer.pop(sample);
+}
+
+uint16_t ADS1115_Acquisition::read(int16_t *dst, uint16_t maxCount){
+    return buffer.read(dst, maxCount);
+}
+
+uint32_t ADS1115_Acquisition::getOverruns(){
+    return loadCounter(overruns);
+}
+
+uint32_t ADS1115_Acquisition::getMissedConversions(){
+    return missedConversions;
+}
+
+void ADS1115_Acquisition::resetCounters(){
+    storeCounter(overruns, 0);
+    missedConversions = 0;
+}
+
+/************************************************
+    private functions
+*************************************************/
+
+void ADS1115_Acquisition::store(int16_t sample){
+    if(!buffer.push(sample)){
+        storeCounter(overruns, loadCounter(overruns) + 1); // only one context calls store()
+    }
+}
+
+/* overruns is incremented in the ISR if the ISR reads the results. On AVR a 32-bit access is 
+   not atomic, therefore interrupts are blocked for the access, like for the ring buffer indices. */
+uint32_t ADS1115_Acquisition::loadCounter(volatile uint32_t &counter){
+#ifdef __AVR__
+    uint8_t sreg = SREG;
+    cli();
+    uint32_t val = counter;
+    SREG = sreg;
+    return val;
+#else
+    return __atomic_load_n(&counter, __ATOMIC_RELAXED);
+#endif
+}
+
+void ADS1115_Acquisition::storeCounter(volatile uint32_t &counter, uint32_t val){
+#ifdef __AVR__
+    uint8_t sreg = SREG;
+    cli();
+    counter = val;
+    SREG = sreg;
+#else
+    __atomic_store_n(&counter, val, __ATOMIC_RELAXED);
+#endif
+}
@@ -0,0 +1,71 @@
+/******************************************************************************
+ *
+ * This is a library for the ADS1115 and ADS1015 A/D Converter
+ *
+ * ADS1115_Acquisition captures continuous conversions into a ring buffer. The
+ * ALERT/RDY pin is used as conversion ready signal. Your interrupt service routine
+ * calls onConversionReady(), loop() calls service() and drains the buffer with
+ * read() whenever it has time.
+ *
+ * Written by Wolfgang (Wolle) Ewald
+ * https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+ * https://wolles-elektronikkiste.de/ads1115 (German)
+ *
+ ******************************************************************************/
+
+#ifndef ADS1115_ACQUISITION_H_
+#define ADS1115_ACQUISITION_H_
+
+#include "ADS1115_WE.h"
+#include "ADS1115_RingBuffer.h"
+
+class ADS1115_Acquisition
+{
+    public:
+        ADS1115_Acquisition(ADS1115_WE &ads, ADS1115_SampleBuffer &buf) :
+            adc{ads}, buffer{buf} {}
+
+        /* Sets the alert pin to conversion ready and starts continuous mode. Range, channels
+         * and rate have to be set before. Permanent auto range mode should be disabled.
+         *
+         * readInISR = false -> the ISR only counts conversions, service() reads them (default)
+         * readInISR = true  -> the ISR reads the conversion register itself (without bus lock, 
+         *                      see getRawResultInISR()). Only use it if your core allows I2C 
+         *                      transactions in interrupts (AVR does not!)
+         */
+        void begin(bool readInISR = false);
+
+        /* Switches back to single shot mode and disables the alert pin */
+        void end();
+
+        /* Call this function from your interrupt service routine (RDY edge) */
+        void onConversionReady();
+
+        /* Reads a pending conversion into the buffer. Call it as often as possible. */
+        void service();
+
+        /* Consumer functions */
+        uint16_t available();
+        bool read(int16_t &sample);
+        uint16_t read(int16_t *dst, uint16_t maxCount);
+
+        /* Samples lost because the buffer was full */
+        uint32_t getOverruns();
+
+        /* Conversions which were overwritten before service() could read them */
+        uint32_t getMissedConversions();
+        void resetCounters();
+
+    protected:
+        void store(int16_t sample);
+        static uint32_t loadCounter(volatile uint32_t &counter);
+        static void storeCounter(volatile uint32_t &counter, uint32_t val);
+        ADS1115_WE &adc;
+        ADS1115_SampleBuffer &buffer;
+        bool readInISR = false;
+        volatile uint8_t pendingConversions = 0;
+        volatile uint32_t overruns = 0;     // written by the ISR if readInISR
+        uint32_t missedConversions = 0;
+};
+
+#endif
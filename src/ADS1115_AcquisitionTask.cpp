@@ -0,0 +1,88 @@
+/*****************************************
+* This is a library for the ADS1115 and ADS1015 A/D Converter
+*
+* You'll find an example which should enable you to use the library.
+*
+* You are free to use it, change it or build on it. In case you like
+* it, it would be cool if you give it a star.
+*
+* If you find bugs, please inform me!
+*
+* Written by Wolfgang (Wolle) Ewald
+* https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+* https://wolles-elektronikkiste.de/ads1115 (German)
+*
+*******************************************/
+
+#include "ADS1115_AcquisitionTask.h"
+
+bool ADS1115_AcquisitionTask::begin(const ADS1115_MUX *list, uint8_t count){
+    if((count == 0) || (count > board.capacity())){
+        return false;
+    }
+    muxList = list;
+    entries = count;
+    timeouts = 0;
+    adc.setMeasureMode(ADS1115_SINGLE);
+    setRunning(true);
+    return true;
+}
+
+bool ADS1115_AcquisitionTask::step(){
+    if(!isRunning()){
+        return false;
+    }
+    ADS1115_Sample samples[ADS1115_SampleBoard::ADS1115_SAMPLE_BOARD_MAX_ENTRIES];
+    bool complete = true;
+    for(uint8_t i=0; i<entries; i++){
+        adc.startSingleMeasurement(muxList[i]);
+        if(!adc.waitForConversion()){
+            timeouts++;
+            complete = false;
+        }
+        adc.getSample(samples[i]);
+    }
+    board.publish(samples, entries, micros());
+    return complete;
+}
+
+void ADS1115_AcquisitionTask::run(uint32_t interval_ms){
+    while(isRunning()){
+        step();
+        if(interval_ms){
+            delay(interval_ms);
+        }
+        else{
+            yield();
+        }
+    }
+}
+
+void ADS1115_AcquisitionTask::stop(){
+    setRunning(false);
+}
+
+uint32_t ADS1115_AcquisitionTask::getTimeouts(){
+    return timeouts;
+}
+
+/************************************************ 
+    private functions
+*************************************************/
+
+/* stop() is called from another task */
+bool ADS1115_AcquisitionTask::isRunning(){
+#ifdef __AVR__
+    return running;
+#else
+    return __atomic_load_n(&running, __ATOMIC_RELAXED);
+#endif
+}
+
+void ADS1115_AcquisitionTask::setRunning(bool run){
+#ifdef __AVR__
+    running = run;
+#else
+    __atomic_store_n(&running, run, __ATOMIC_RELAXED);
+#endif
+}
@@ -0,0 +1,63 @@
+/******************************************************************************
+ *
+ * This is a library for the ADS1115 and ADS1015 A/D Converter
+ *
+ * ADS1115_AcquisitionTask owns one ADS1115_WE object and measures a list of
+ * channels in single shot mode, set after set. Each complete set is published
+ * to an ADS1115_SharedSamples board, where other tasks read the latest samples
+ * without any I2C access. Run it in a task of its own (RTOS, e.g. ESP32):
+ *
+ * void acquisitionTask(void *){ acquisition.run(); }
+ * xTaskCreate(acquisitionTask, "ads1115", 4096, nullptr, 2, nullptr);
+ *
+ * or call step() from loop() on boards without RTOS. Waiting for conversions is
+ * done with the wait strategy of the ADS1115_WE object (see setWaitStrategy()).
+ * If other tasks use the same bus, set a bus lock (see setBusLock()).
+ *
+ * Written by Wolfgang (Wolle) Ewald
+ * https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+ * https://wolles-elektronikkiste.de/ads1115 (German)
+ *
+ ******************************************************************************/
+
+#ifndef ADS1115_ACQUISITION_TASK_H_
+#define ADS1115_ACQUISITION_TASK_H_
+
+#include "ADS1115_WE.h"
+#include "ADS1115_SharedSamples.h"
+
+class ADS1115_AcquisitionTask
+{
+    public:
+        ADS1115_AcquisitionTask(ADS1115_WE &ads, ADS1115_SampleBoard &samples) :
+            adc{ads}, board{samples} {}
+
+        /* The list is not copied, it has to exist as long as the acquisition runs. Up to
+         * board.capacity() entries. Range, rate and wait strategy have to be set before. */
+        bool begin(const ADS1115_MUX *list, uint8_t count);
+
+        /* Measures every entry once and publishes the set. Blocks for the conversions. 
+         * Returns false if not started or if a conversion was not signalled in time (the 
+         * set is published anyway). */
+        bool step();
+
+        /* Calls step() until stop() is called (from any task). interval_ms: pause between 
+         * two sets, 0 = yield() only. */
+        void run(uint32_t interval_ms = 0);
+        void stop();
+
+        /* Conversions which were not signalled in time */
+        uint32_t getTimeouts();
+
+    protected:
+        ADS1115_WE &adc;
+        ADS1115_SampleBoard &board;
+        const ADS1115_MUX *muxList = nullptr;
+        uint8_t entries = 0;
+        volatile bool running = false;
+        uint32_t timeouts = 0;
+        bool isRunning();
+        void setRunning(bool run);
+};
+
+#endif
@@ -0,0 +1,151 @@
+/*****************************************
+* This is a library for the ADS1115 and ADS1015 A/D Converter
+*
+* You'll find an example which should enable you to use the library.
+*
+* You are free to use it, change it or build on it. In case you like
+* it, it would be cool if you give it a star.
+*
+* If you find bugs, please inform me!
+*
+* Written by Wolfgang (Wolle) Ewald
+* https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+* https://wolles-elektronikkiste.de/ads1115 (German)
+*
+*******************************************/
+
+#include "ADS1115_Array.h"
+
+int8_t ADS1115_Array::addDevice(ADS1115_WE &ads){
+    if(running || (numDevices >= ADS1115_ARRAY_MAX_DEVICES)){
+        return -1;
+    }
+    devices[numDevices] = &ads;
+    return numDevices++;
+}
+
+bool ADS1115_Array::begin(uint8_t channelsPerDevice){
+    if((numDevices == 0) || (channelsPerDevice == 0) || (channelsPerDevice > 4)){
+        return false;
+    }
+    channels = channelsPerDevice;
+    for(uint8_t i=0; i<numDevices; i++){
+        devices[i]->setMeasureMode(ADS1115_SINGLE);
+    }
+    running = true;
+    startFrame();
+    return true;
+}
+
+void ADS1115_Array::stop(){
+    running = false;
+}
+
+bool ADS1115_Array::update(){
+    if(!running){
+        return false;
+    }
+    /* poll round robin, starting behind the device served last, so that no device 
+       has to wait for the others. No I2C access before a conversion can be completed. */
+    uint8_t start = pollStart; // each device is visited once per call
+    uint8_t next = pollStart;
+    for(uint8_t n=0; n<numDevices; n++){
+        uint8_t i = (start + n) % numDevices;
+        if(!(pendingMask & (1 << i)) || !devices[i]->isConvDue() || devices[i]->isBusy()){
+            continue;
+        }
+        uint8_t entry = i * channels + nextChannel[i];
+        workFrame[entry] = devices[i]->getRawResult();
+        workRanges[entry] = devices[i]->getVoltageRange_mV();
+        nextChannel[i]++;
+        if(nextChannel[i] < channels){
+            devices[i]->startSingleMeasurement(singleEndedMux(nextChannel[i]));
+        }
+        else{
+            pendingMask &= ~(1 << i);
+        }
+        next = (i + 1) % numDevices;
+    }
+    pollStart = next;
+
+    if(pendingMask){
+        return false;
+    }
+    uint8_t frameSize = numDevices * channels;
+    for(uint8_t i=0; i<frameSize; i++){
+        rawResults[i] = workFrame[i];
+        voltageRanges[i] = workRanges[i];
+    }
+    frameCount++;
+    startFrame();
+    return true;
+}
+
+uint8_t ADS1115_Array::readFrame(int16_t *frame){
+    if(!running){
+        return 0;
+    }
+    while(!update()){
+        for(uint8_t i=0; i<numDevices; i++){
+            if((pendingMask & (1 << i)) && devices[i]->isConvOverdue()){
+                startFrame();
+                return 0;
+            }
+        }
+        yield();
+    }
+    uint8_t frameSize = getFrameSize();
+    for(uint8_t i=0; i<frameSize; i++){
+        frame[i] = rawResults[i];
+    }
+    return frameSize;
+}
+
+uint8_t ADS1115_Array::getFrameSize(){
+    return numDevices * channels;
+}
+
+int16_t ADS1115_Array::getRawResult(uint8_t entry){
+    if(entry >= getFrameSize()){
+        return 0;
+    }
+    return rawResults[entry];
+}
+
+#ifndef ADS1115_NO_FLOAT
+float ADS1115_Array::getResult_mV(uint8_t entry){
+    if(entry >= getFrameSize()){
+        return 0.0;
+    }
+    return (static_cast<int32_t>(rawResults[entry]) * voltageRanges[entry] * 2) / 65536.0;
+}
+#endif
+
+int32_t ADS1115_Array::getResult_uV(uint8_t entry){
+    if(entry >= getFrameSize()){
+        return 0;
+    }
+    return ADS1115_WE::rawToMicrovolts(rawResults[entry], voltageRanges[entry] >> 8);
+}
+
+uint32_t ADS1115_Array::getFrameCount(){
+    return frameCount;
+}
+
+/************************************************ 
+    private functions
+*************************************************/
+
+void ADS1115_Array::startFrame(){
+    /* start all devices back to back, the conversions run in parallel */
+    for(uint8_t i=0; i<numDevices; i++){
+        nextChannel[i] = 0;
+        devices[i]->startSingleMeasurement(singleEndedMux(0));
+    }
+    pendingMask = (1 << numDevices) - 1;
+    pollStart = 0;
+}
+
+ADS1115_MUX ADS1115_Array::singleEndedMux(uint8_t channel){
+    return static_cast<ADS1115_MUX>(ADS1115_COMP_0_GND + (channel << 12));
+}
@@ -0,0 +1,77 @@
+/******************************************************************************
+ *
+ * This is a library for the ADS1115 and ADS1015 A/D Converter
+ *
+ * ADS1115_Array manages up to four ADS1115 / ADS1015 on one bus (addresses 0x48 to
+ * 0x4B) and measures their single ended channels into one frame of up to 16 values.
+ * The conversions of all devices run in parallel: each device is started back to 
+ * back, and whenever one of them has finished, its result is read and its next 
+ * channel is started at once. So the conversion times overlap instead of adding up.
+ *
+ * Frame layout: entry = device index * channelsPerDevice + channel
+ *
+ * Written by Wolfgang (Wolle) Ewald
+ * https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+ * https://wolles-elektronikkiste.de/ads1115 (German)
+ *
+ ******************************************************************************/
+
+#ifndef ADS1115_ARRAY_H_
+#define ADS1115_ARRAY_H_
+
+#include "ADS1115_WE.h"
+
+class ADS1115_Array
+{
+    public:
+        static constexpr uint8_t ADS1115_ARRAY_MAX_DEVICES {4};
+        static constexpr uint8_t ADS1115_ARRAY_MAX_CHANNELS {16};
+
+        /* Adds an initialized device (init(), range and rate already set). Returns its 
+         * index or -1 if the array is full. */
+        int8_t addDevice(ADS1115_WE &ads);
+
+        /* Starts the first frame. Channels 0 ... channelsPerDevice-1 vs. GND are measured 
+         * on every device. */
+        bool begin(uint8_t channelsPerDevice = 4);
+        void stop();
+
+        /* Non-blocking step: collects finished conversions in the order the devices 
+         * complete them and starts the next ones. Returns true if a frame is complete; 
+         * the next frame is started immediately. */
+        bool update();
+
+        /* Blocking: waits for the next complete frame and copies it (getFrameSize() values). 
+         * The devices are not polled before their conversions can be completed. Returns 0 if 
+         * a device did not complete a conversion in time (isConvOverdue()), the frame is then 
+         * started again. */
+        uint8_t readFrame(int16_t *frame);
+
+        /* Latest complete frame */
+        uint8_t getFrameSize();
+        int16_t getRawResult(uint8_t entry);
+#ifndef ADS1115_NO_FLOAT
+        float getResult_mV(uint8_t entry);
+#endif
+        int32_t getResult_uV(uint8_t entry);
+        uint32_t getFrameCount();
+
+    protected:
+        ADS1115_WE *devices[ADS1115_ARRAY_MAX_DEVICES] = {nullptr};
+        uint8_t numDevices = 0;
+        uint8_t channels = 0;
+        uint8_t nextChannel[ADS1115_ARRAY_MAX_DEVICES] = {0};  // channel in conversion
+        uint8_t pendingMask = 0;                                // devices still converting
+        uint8_t pollStart = 0;
+        bool running = false;
+        uint32_t frameCount = 0;
+        int16_t workFrame[ADS1115_ARRAY_MAX_CHANNELS] = {0};     // frame in progress
+        uint16_t workRanges[ADS1115_ARRAY_MAX_CHANNELS] = {0};
+        int16_t rawResults[ADS1115_ARRAY_MAX_CHANNELS] = {0};
+        uint16_t voltageRanges[ADS1115_ARRAY_MAX_CHANNELS] = {0};
+
+        void startFrame();
+        static ADS1115_MUX singleEndedMux(uint8_t channel);
+};
+
+#endif
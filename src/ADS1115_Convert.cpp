@@ -0,0 +1,132 @@
+/*****************************************
+* This is a library for the ADS1115 and ADS1015 A/D Converter
+*
+* You'll find an example which should enable you to use the library.
+*
+* You are free to use it, change it or build on it. In case you like
+* it, it would be cool if you give it a star.
+*
+* If you find bugs, please inform me!
+*
+* Written by Wolfgang (Wolle) Ewald
+* https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+* https://wolles-elektronikkiste.de/ads1115 (German)
+*
+*******************************************/
+
+#include "ADS1115_Convert.h"
+
+/* -O2 does not vectorize the loops below (before GCC 12 not at all, then only with a very cheap cost 
+   model), so the auto vectorizer is switched on for the conversion functions only. With -Os, GCC 
+   does not vectorize anyway. */
+#if defined(__GNUC__) && !defined(__clang__)
+#define ADS1115_VECTORIZE __attribute__((optimize("tree-vectorize")))
+#else
+#define ADS1115_VECTORIZE
+#endif
+
+#if defined(__SSE2__) && !defined(ADS1115_NO_SIMD)
+#include <emmintrin.h>
+#define ADS1115_CONVERT_SSE2
+
+/* x / 65535 = (x + (x >> 16) + 1) >> 16 for x <= 65535 * 65535 + 32767 (checked for all x) */
+static inline __m128i divBy65535(__m128i x){
+    __m128i sum = _mm_add_epi32(_mm_add_epi32(x, _mm_srli_epi32(x, 16)), _mm_set1_epi32(1));
+    return _mm_srli_epi32(sum, 16);
+}
+#endif
+
+#ifndef ADS1115_NO_FLOAT
+ADS1115_VECTORIZE void ADS1115_Convert::convertToMilliVolts(const int16_t *raw, float *mV, size_t n, ADS1115_RANGE range,
+                                          float gain, float offset_mV){
+    /* range / 32768 has at most 2 significant bits, so raw * scale is exact if gain = 1 */
+    const float scale = ADS1115_WE::rangeToMillivolts(range) / 32768.0f * gain;
+    size_t i = 0;
+#ifdef ADS1115_CONVERT_SSE2
+    const __m128 vScale = _mm_set1_ps(scale);
+    const __m128 vOffset = _mm_set1_ps(offset_mV);
+    for(; i + 8 <= n; i += 8){
+        __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(raw + i));
+        __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(r, r), 16); // sign extension to int32
+        __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(r, r), 16);
+        _mm_storeu_ps(mV + i, _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(lo), vScale), vOffset));
+        _mm_storeu_ps(mV + i + 4, _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(hi), vScale), vOffset));
+    }
+#endif
+    for(; i < n; i++){
+        mV[i] = raw[i] * scale + offset_mV;
+    }
+}
+#endif
+
+/* Same calculation as getResult_uV() (ADS1115_WE::rawToMicrovolts()) */
+ADS1115_VECTORIZE void ADS1115_Convert::convertToMicroVolts(const int16_t *raw, int32_t *uV, size_t n, ADS1115_RANGE range,
+                                          int32_t offset_uV){
+    const uint8_t factor = ADS1115_WE::rangeFactor(range);
+    size_t i = 0;
+#ifdef ADS1115_CONVERT_SSE2
+    /* (raw * factor * 125 + 8) >> 4 like rawToMicrovolts(), checked against it for all raw values
+       by extras/host/convert_benchmark.cpp. 16 x 16 bit multiplication, the low and high halves
+       are joined to the 32 bit products. */
+    const __m128i vFactor = _mm_set1_epi16(factor * 125); // max. 3000
+    const __m128i vRound = _mm_set1_epi32(8);
+    const __m128i vOffset = _mm_set1_epi32(offset_uV);
+    for(; i + 8 <= n; i += 8){
+        __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(raw + i));
+        __m128i prodLo = _mm_mullo_epi16(r, vFactor);
+        __m128i prodHi = _mm_mulhi_epi16(r, vFactor);
+        __m128i p0 = _mm_unpacklo_epi16(prodLo, prodHi);
+        __m128i p1 = _mm_unpackhi_epi16(prodLo, prodHi);
+        p0 = _mm_add_epi32(_mm_srai_epi32(_mm_add_epi32(p0, vRound), 4), vOffset);
+        p1 = _mm_add_epi32(_mm_srai_epi32(_mm_add_epi32(p1, vRound), 4), vOffset);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(uV + i), p0);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(uV + i + 4), p1);
+    }
+#endif
+    for(; i < n; i++){
+        uV[i] = ADS1115_WE::rawToMicrovolts(raw[i], factor) + offset_uV;
+    }
+}
+
+/* Same calculation as getResultWithRange(min, max), but the division by 65535 is replaced by
+   shifts (see divBy65535()), which the compiler can vectorize */
+ADS1115_VECTORIZE void ADS1115_Convert::convertToRange(const int16_t *raw, int16_t *out, size_t n, int16_t min, int16_t max){
+    int32_t span = static_cast<int32_t>(max) - min;
+    const uint32_t absSpan = (span < 0) ? -span : span;
+    const int32_t sign = (span < 0) ? -1 : 1;
+    size_t i = 0;
+#ifdef ADS1115_CONVERT_SSE2
+    const __m128i vSpan = _mm_set1_epi16(static_cast<int16_t>(absSpan));
+    const __m128i vBias = _mm_set1_epi16(static_cast<int16_t>(0x8000));
+    const __m128i vHalf = _mm_set1_epi32(32767);
+    const __m128i vMin = _mm_set1_epi16(min);
+    for(; i + 8 <= n; i += 8){
+        __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(raw + i));
+        __m128i offset = _mm_xor_si128(r, vBias); // raw + 32768 as uint16_t
+        __m128i prodLo = _mm_mullo_epi16(offset, vSpan);
+        __m128i prodHi = _mm_mulhi_epu16(offset, vSpan);
+        __m128i q0 = divBy65535(_mm_add_epi32(_mm_unpacklo_epi16(prodLo, prodHi), vHalf));
+        __m128i q1 = divBy65535(_mm_add_epi32(_mm_unpackhi_epi16(prodLo, prodHi), vHalf));
+        /* q <= 65535: sign extend the low 16 bits, so that the packing does not saturate */
+        q0 = _mm_srai_epi32(_mm_slli_epi32(q0, 16), 16);
+        q1 = _mm_srai_epi32(_mm_slli_epi32(q1, 16), 16);
+        __m128i q = _mm_packs_epi32(q0, q1);
+        q = (sign < 0) ? _mm_sub_epi16(vMin, q) : _mm_add_epi16(vMin, q);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), q);
+    }
+#endif
+    for(; i < n; i++){
+        uint32_t x = static_cast<uint32_t>(static_cast<int32_t>(raw[i]) + 32768) * absSpan + 32767;
+        int32_t scaled = (x + (x >> 16) + 1) >> 16; // x / 65535
+        out[i] = min + sign * scaled;
+    }
+}
+
+ADS1115_VECTORIZE void ADS1115_Convert::convertToRange(const int16_t *raw, int16_t *out, size_t n, int16_t min, int16_t max,
+                                     int16_t maxMillivolt, ADS1115_RANGE range){
+    convertToRange(raw, out, n, min, max);
+    const uint16_t voltageRange = ADS1115_WE::rangeToMillivolts(range);
+    for(size_t i=0; i<n; i++){
+        out[i] = ADS1115_WE::rangeToMillivoltScale(out[i], voltageRange, maxMillivolt);
+    }
+}
@@ -0,0 +1,65 @@
+/******************************************************************************
+ *
+ * This is a library for the ADS1115 and ADS1015 A/D Converter
+ *
+ * ADS1115_Convert converts blocks of raw results (e.g. from readBlock() or a
+ * ADS1115_SampleBuffer) in one go, with the same results as getResult_mV(),
+ * getResult_uV() and getResultWithRange() for single values. The range, gain and
+ * offset are set per block, the per sample work is one multiplication and one
+ * addition, without doubles. The loops are simple enough for the auto vectorizer
+ * of GCC, which is switched on for the conversion functions (not with -Os). With
+ * SSE2 (all x86-64 hosts) an explicit SIMD path converts 8 samples per step;
+ * define ADS1115_NO_SIMD to use the plain loops.
+ *
+ * int16_t raw[256];
+ * float mV[256];
+ * size_t n = adc.readBlock(raw, 256);
+ * ADS1115_Convert::convertToMilliVolts(raw, mV, n, ADS1115_RANGE_4096);
+ *
+ * Raw results of the ADS1015 are in the same format (12 bit result * 16).
+ *
+ * Written by Wolfgang (Wolle) Ewald
+ * https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+ * https://wolles-elektronikkiste.de/ads1115 (German)
+ *
+ ******************************************************************************/
+
+#ifndef ADS1115_CONVERT_H_
+#define ADS1115_CONVERT_H_
+
+#include "ADS1115_WE.h"
+
+class ADS1115_Convert
+{
+    public:
+#ifndef ADS1115_NO_FLOAT
+        /* mV[i] = raw[i] * range / 32768 * gain + offset_mV. With gain = 1 and offset_mV = 0, the
+         * results are identical to getResult_mV(). */
+        static void convertToMilliVolts(const int16_t *raw, float *mV, size_t n, ADS1115_RANGE range,
+                                        float gain = 1.0, float offset_mV = 0.0);
+#endif
+
+        /* uV[i] = raw[i] * rangeFactor * 7.8125 µV (rounded) + offset_uV. With offset_uV = 0, the
+         * results are identical to getResult_uV(). */
+        static void convertToMicroVolts(const int16_t *raw, int32_t *uV, size_t n, ADS1115_RANGE range,
+                                        int32_t offset_uV = 0);
+
+        /* Same as getResultWithRange(min, max) for each value, raw and out may be the same buffer */
+        static void convertToRange(const int16_t *raw, int16_t *out, size_t n, int16_t min, int16_t max);
+
+        /* Same as getResultWithRange(min, max, maxMillivolt) for each value, range is the voltage
+         * range the values were measured with. The second step (division) is not vectorized. */
+        static void convertToRange(const int16_t *raw, int16_t *out, size_t n, int16_t min, int16_t max,
+                                   int16_t maxMillivolt, ADS1115_RANGE range);
+
+        /* true if the explicit SIMD path is compiled in */
+        static constexpr bool hasSimd(){
+#if defined(__SSE2__) && !defined(ADS1115_NO_SIMD)
+            return true;
+#else
+            return false;
+#endif
+        }
+};
+
+#endif
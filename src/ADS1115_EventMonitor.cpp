@@ -0,0 +1,216 @@
+/*****************************************
+* This is a library for the ADS1115 and ADS1015 A/D Converter
+*
+* You'll find an example which should enable you to use the library.
+*
+* You are free to use it, change it or build on it. In case you like
+* it, it would be cool if you give it a star.
+*
+* If you find bugs, please inform me!
+*
+* Written by Wolfgang (Wolle) Ewald
+* https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+* https://wolles-elektronikkiste.de/ads1115 (German)
+*
+*******************************************/
+
+#include "ADS1115_EventMonitor.h"
+
+bool ADS1115_EventMonitor::begin(const ADS1115_EventChannel *list, uint8_t count, uint16_t dwellConversions,
+                                 ADS1115_COMP_QUE queue){
+    if((count == 0) || (queue == ADS1115_DISABLE_ALERT)){
+        return false;
+    }
+    /* lo > hi would also be invalid for the chip: a negative hi and a positive lo limit
+       switch the ALERT pin to conversion ready */
+    for(uint8_t i=0; i<count; i++){
+        if(list[i].loLimit > list[i].hiLimit){
+            return false;
+        }
+    }
+    useInterrupt = (adc.getWaitStrategy() == ADS1115_WAIT_INTERRUPT);
+    if(!useInterrupt && (adc.getReadyPin() < 0)){
+        return false;
+    }
+    channels = list;
+    entries = count;
+    alerts = 0;
+    spuriousAlerts = 0;
+    rotations = 0;
+
+    /* the conversion in progress at a channel change belongs to the previous channel, the
+       next one is completed at the latest after two conversion times */
+    uint32_t maxConvTime = adc.getMaxConvTime_us();
+    settleTime = 2 * maxConvTime;
+    if(dwellConversions < 1){
+        dwellConversions = 1;
+    }
+    if((dwellConversions + 1UL) <= (0xFFFFFFFFUL / maxConvTime)){
+        dwellTime = (dwellConversions + 1UL) * maxConvTime;
+    }
+    else{
+        dwellTime = 0xFFFFFFFFUL;
+    }
+
+    /* one transaction: the comparator settings and the first entry are written together */
+    adc.beginConfig();
+    adc.setAlertPinMode(queue);
+    adc.setAlertLatch(ADS1115_LATCH_ENABLED);
+    adc.setMeasureMode(ADS1115_CONTINUOUS);
+    stage(0);
+    adc.commitConfig();
+    armed = 0;
+    armTime = micros();
+    verifyNext = true;
+    adc.clearReadyEvents();
+    adc.clearAlert(); // an alert latched before would never cause an edge
+    running = true;
+    return true;
+}
+
+void ADS1115_EventMonitor::end(){
+    running = false;
+    adc.beginConfig();
+    adc.setAlertPinMode(ADS1115_DISABLE_ALERT);
+    adc.setAlertLatch(ADS1115_LATCH_DISABLED);
+    adc.setMeasureMode(ADS1115_SINGLE);
+    adc.commitConfig();
+}
+
+#ifndef ADS1115_NO_WAIT_STRATEGY
+void ADS1115_EventMonitor::notifyAlert(){
+    adc.notifyConversionReady();
+}
+#endif
+
+bool ADS1115_EventMonitor::poll(ADS1115_Event &event){
+    if(!running){
+        return false;
+    }
+    bool found = false;
+    /* alerts are left latched until results of the armed channel are certain */
+    if((micros() - armTime) >= settleTime){
+        bool verify = verifyNext;
+        verifyNext = false;
+        if(alertPending()){
+            found = readAlert(event, verify);
+        }
+    }
+    if((entries > 1) && ((micros() - armTime) >= dwellTime)){
+        arm((armed + 1) % entries);
+        rotations++;
+    }
+    return found;
+}
+
+bool ADS1115_EventMonitor::waitForEvent(ADS1115_Event &event, uint32_t timeout_ms){
+    unsigned long startTime = millis();
+    while(running){
+        if(poll(event)){
+            return true;
+        }
+        uint32_t waitTime = timeToNextAction();
+        if(timeout_ms){
+            uint32_t elapsed = millis() - startTime;
+            if(elapsed >= timeout_ms){
+                return false;
+            }
+            if((waitTime / 1000) >= (timeout_ms - elapsed)){
+                waitTime = (timeout_ms - elapsed) * 1000UL;
+            }
+        }
+        if(waitTime == 0){
+            continue;
+        }
+        if(alertPending()){ // the alert is read when the new channel has settled
+            delay(waitTime / 1000);
+            delayMicroseconds(waitTime % 1000);
+        }
+        else{
+            adc.waitForReadySignal(waitTime);
+        }
+    }
+    return false;
+}
+
+uint8_t ADS1115_EventMonitor::getArmedEntry(){
+    return armed;
+}
+
+uint32_t ADS1115_EventMonitor::getAlerts(){
+    return alerts;
+}
+
+uint32_t ADS1115_EventMonitor::getSpuriousAlerts(){
+    return spuriousAlerts;
+}
+
+uint32_t ADS1115_EventMonitor::getRotations(){
+    return rotations;
+}
+
+/************************************************
+    private functions
+*************************************************/
+
+/* Only the registers which differ from the previous entry are written */
+void ADS1115_EventMonitor::arm(uint8_t entry){
+    adc.beginConfig();
+    stage(entry);
+    adc.commitConfig();
+    armed = entry;
+    armTime = micros();
+    verifyNext = true;
+}
+
+/* Setters of an entry, to be called within beginConfig() / commitConfig() */
+void ADS1115_EventMonitor::stage(uint8_t entry){
+    const ADS1115_EventChannel &channel = channels[entry];
+    adc.setVoltageRange_mV_nonblock(channel.range);
+    adc.setCompareChannels_nonblock(channel.mux);
+    adc.setAlertModeAndLimit_raw(channel.mode, channel.hiLimit, channel.loLimit);
+}
+
+bool ADS1115_EventMonitor::alertPending(){
+    if(useInterrupt){
+        return adc.getReadyEvents();
+    }
+    return adc.isReadyPinActive();
+}
+
+/* Reading the conversion register clears the latch. The events are reset before, so that
+   an alert right after the read is not lost. */
+bool ADS1115_EventMonitor::readAlert(ADS1115_Event &event, bool verify){
+    adc.clearReadyEvents();
+    int16_t raw = adc.clearAlert();
+    alerts++;
+    const ADS1115_EventChannel &channel = channels[armed];
+    if(verify && !beyondLimits(channel, raw)){
+        spuriousAlerts++;
+        return false;
+    }
+    event.entry = armed;
+    event.sample.raw = raw;
+    event.sample.range = channel.range;
+    event.time = micros();
+    return true;
+}
+
+bool ADS1115_EventMonitor::beyondLimits(const ADS1115_EventChannel &channel, int16_t raw){
+    if(channel.mode == ADS1115_WINDOW){
+        return (raw > channel.hiLimit) || (raw < channel.loLimit);
+    }
+    return raw > channel.hiLimit;
+}
+
+/* Time in µs until poll() has something to do without a (new) alert */
+uint32_t ADS1115_EventMonitor::timeToNextAction(){
+    uint32_t sinceArm = micros() - armTime;
+    if((sinceArm < settleTime) && alertPending()){
+        return settleTime - sinceArm;
+    }
+    if(entries > 1){
+        return (sinceArm < dwellTime) ? (dwellTime - sinceArm) : 0;
+    }
+    return 1000000; // only the alert, check running once per second
+}
@@ -0,0 +1,113 @@
+/******************************************************************************
+ *
+ * This is a library for the ADS1115 and ADS1015 A/D Converter
+ *
+ * ADS1115_EventMonitor lets the comparator of the ADS1115 watch one or more
+ * channels, so the MCU only has to wake up when a limit is exceeded. The
+ * ADS1115 runs in continuous mode with latched alert. The monitor arms the
+ * limits (precomputed raw values) of one channel after the other, each for a
+ * number of conversions (dwell). With a single channel there is no bus traffic
+ * at all until the ALERT pin becomes active. The event is then read from the
+ * conversion register, which clears the latch and re-arms the comparator.
+ *
+ * The ALERT pin is either polled (setReadyPin()) or, better for low power,
+ * connected to an interrupt (setWaitStrategy(ADS1115_WAIT_INTERRUPT)):
+ *
+ * void alertISR(){ monitor.notifyAlert(); }
+ * attachInterrupt(digitalPinToInterrupt(pin), alertISR, FALLING);
+ *
+ * After a channel change, the conversion in progress is still completed with
+ * the previous channel, but compared with the new limits. Alerts in this phase
+ * are therefore only reported if the value read afterwards still exceeds the
+ * limits of the new channel (otherwise they count as spurious).
+ *
+ * Written by Wolfgang (Wolle) Ewald
+ * https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+ * https://wolles-elektronikkiste.de/ads1115 (German)
+ *
+ ******************************************************************************/
+
+#ifndef ADS1115_EVENT_MONITOR_H_
+#define ADS1115_EVENT_MONITOR_H_
+
+#include "ADS1115_WE.h"
+
+/* Limits are raw values in the given range, see ADS1115_WE::millivoltsToRaw().
+ * ADS1115_MAX_LIMIT: alert above hiLimit (loLimit is only checked to be <= hiLimit).
+ * ADS1115_WINDOW: alert above hiLimit or below loLimit. */
+struct ADS1115_EventChannel {
+    ADS1115_MUX mux;
+    ADS1115_RANGE range;
+    ADS1115_COMP_MODE mode;
+    int16_t hiLimit;
+    int16_t loLimit;
+};
+
+struct ADS1115_Event {
+    uint8_t entry;              // index in the channel list
+    ADS1115_Sample sample;      // value read after the alert
+    unsigned long time;         // micros()
+};
+
+class ADS1115_EventMonitor
+{
+    public:
+        ADS1115_EventMonitor(ADS1115_WE &ads) : adc{ads} {}
+
+        /* The list is not copied, it has to exist as long as the monitor runs.
+         * dwellConversions: conversions per channel before the next channel is armed (only
+         * with more than one entry). queue: ADS1115_ASSERT_AFTER_1, _2 or _4 consecutive
+         * conversions beyond the limits. Set the conversion rate, the alert polarity and the
+         * ready pin or the interrupt wait strategy before. Returns false if the list is
+         * invalid or there is no way to detect the alert. */
+        bool begin(const ADS1115_EventChannel *list, uint8_t count, uint16_t dwellConversions = 8,
+                   ADS1115_COMP_QUE queue = ADS1115_ASSERT_AFTER_1);
+
+        /* Disables the comparator and switches the ADS1115 to single shot mode (power-down) */
+        void end();
+
+#ifndef ADS1115_NO_WAIT_STRATEGY
+        /* Call it from the ISR attached to the ALERT pin (ADS1115_WAIT_INTERRUPT) */
+        void notifyAlert();
+#endif
+
+        /* Never blocks: reads a pending alert and arms the next channel if its dwell time
+         * is over. Returns true if event was filled. Call it after each wake-up. */
+        bool poll(ADS1115_Event &event);
+
+        /* Waits (sleeps between interrupts on AVR boards) until an event occurs or timeout_ms
+         * has passed, 0 = no timeout. Channels are armed in between as needed. */
+        bool waitForEvent(ADS1115_Event &event, uint32_t timeout_ms = 0);
+
+        /* Entry which is currently armed */
+        uint8_t getArmedEntry();
+
+        /* Alerts read (including spurious ones), spurious alerts after channel changes and
+         * channel changes since begin() */
+        uint32_t getAlerts();
+        uint32_t getSpuriousAlerts();
+        uint32_t getRotations();
+
+    protected:
+        ADS1115_WE &adc;
+        const ADS1115_EventChannel *channels = nullptr;
+        uint8_t entries = 0;
+        uint8_t armed = 0;
+        bool running = false;
+        bool useInterrupt = false;
+        bool verifyNext = false;        // the first alert after a channel change is checked
+        uint32_t dwellTime = 0;         // µs per channel
+        uint32_t settleTime = 0;        // µs until results of the new channel are certain
+        unsigned long armTime = 0;
+        uint32_t alerts = 0;
+        uint32_t spuriousAlerts = 0;
+        uint32_t rotations = 0;
+        void arm(uint8_t entry);
+        void stage(uint8_t entry);
+        bool alertPending();
+        bool readAlert(ADS1115_Event &event, bool verify);
+        bool beyondLimits(const ADS1115_EventChannel &channel, int16_t raw);
+        uint32_t timeToNextAction();
+};
+
+#endif
@@ -0,0 +1,245 @@
+/******************************************************************************
+ *
+ * This is a library for the ADS1115 and ADS1015 A/D Converter
+ *
+ * Integer filters for raw results, e.g. to reduce the noise of oversampled
+ * signals. All state is part of the objects (no heap), the sizes are template
+ * parameters:
+ *
+ * ADS1115_Median<N>           running median of the last N results (spike rejection)
+ * ADS1115_Decimator<FACTOR>   boxcar average of FACTOR results (first order CIC),
+ *                             delivers one result per FACTOR input results
+ * ADS1115_EMA<SHIFT>          exponential moving average, alpha = 1 / 2^SHIFT
+ * ADS1115_Filter<MEDIAN, DECIMATION, EMA_SHIFT>
+ *                             median -> decimator -> EMA, each stage can be bypassed
+ *                             (MEDIAN = 1, DECIMATION = 1, EMA_SHIFT = 0)
+ * ADS1115_FilterBank<CHANNELS, MEDIAN, DECIMATION, EMA_SHIFT>
+ *                             one ADS1115_Filter per channel
+ *
+ * The filters work on raw values, so the range must not change while filtering.
+ *
+ * Written by Wolfgang (Wolle) Ewald
+ * https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+ * https://wolles-elektronikkiste.de/ads1115 (German)
+ *
+ ******************************************************************************/
+
+#ifndef ADS1115_FILTER_H_
+#define ADS1115_FILTER_H_
+
+#if (ARDUINO >= 100)
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "ADS1115_RingBuffer.h"
+
+template<uint8_t N>
+class ADS1115_Median
+{
+    static_assert((N % 2 == 1) && (N <= 15), "N must be odd and not greater than 15");
+
+    public:
+        /* Adds a result and returns the median of the last N results. Until N results have
+           been added, the median of the results available so far is returned. */
+        int16_t push(int16_t in){
+            if(N == 1){
+                return in;
+            }
+            if(count < N){
+                count++;
+            }
+            else{
+                remove(window[oldest]);
+            }
+            window[oldest] = in;
+            oldest = (oldest + 1 < N) ? oldest + 1 : 0;
+            insert(in);
+            return sorted[(count - 1) / 2];
+        }
+
+        void reset(){
+            count = 0;
+            oldest = 0;
+        }
+
+    protected:
+        int16_t window[N];      // last N results in order of arrival
+        int16_t sorted[N];      // the same results, sorted
+        uint8_t count = 0;
+        uint8_t oldest = 0;
+
+        void remove(int16_t val){
+            uint8_t i = 0;
+            while(sorted[i] != val){
+                i++;
+            }
+            for(; i < count - 1; i++){
+                sorted[i] = sorted[i + 1];
+            }
+        }
+
+        void insert(int16_t val){
+            uint8_t i = count - 1;
+            while((i > 0) && (sorted[i - 1] > val)){
+                sorted[i] = sorted[i - 1];
+                i--;
+            }
+            sorted[i] = val;
+        }
+};
+
+template<uint16_t FACTOR>
+class ADS1115_Decimator
+{
+    static_assert(FACTOR >= 1, "FACTOR must be at least 1");
+
+    public:
+        /* Adds a result. Returns true and the rounded average in out after FACTOR results. */
+        bool push(int16_t in, int16_t &out){
+            sum += in;
+            if(++count < FACTOR){
+                return false;
+            }
+            out = average();
+            sum = 0;
+            count = 0;
+            return true;
+        }
+
+        void reset(){
+            sum = 0;
+            count = 0;
+        }
+
+    protected:
+        int32_t sum = 0;
+        uint16_t count = 0;
+
+        static constexpr bool isPowerOfTwo(){
+            return (FACTOR & (FACTOR - 1)) == 0;
+        }
+        static constexpr uint8_t log2(uint16_t val){
+            return (val > 1) ? 1 + log2(val >> 1) : 0;
+        }
+
+        /* rounded half up in both paths: floor((sum + FACTOR / 2) / FACTOR). The shift for powers 
+           of two is a floor division (arithmetic shift), the division rounds toward zero, so 
+           negative values are corrected. */
+        int16_t average(){
+            int32_t val = sum + (int32_t)(FACTOR / 2);
+            if(isPowerOfTwo()){
+                return val >> log2(FACTOR);
+            }
+            return (val >= 0) ? val / (int32_t)FACTOR : (val - ((int32_t)FACTOR - 1)) / (int32_t)FACTOR;
+        }
+};
+
+template<uint8_t SHIFT>
+class ADS1115_EMA
+{
+    static_assert(SHIFT <= 15, "SHIFT must not be greater than 15");
+
+    public:
+        /* Adds a result and returns the new average. The first result initializes the average. */
+        int16_t push(int16_t in){
+            if(!started){
+                acc = static_cast<int32_t>(in) << SHIFT;
+                started = true;
+            }
+            else{
+                acc += in - read();
+            }
+            return read();
+        }
+
+        int16_t read(){
+            return (acc + ((1L << SHIFT) >> 1)) >> SHIFT;
+        }
+
+        void reset(){
+            started = false;
+        }
+
+    protected:
+        int32_t acc = 0;        // average * 2^SHIFT
+        bool started = false;
+};
+
+template<uint8_t MEDIAN, uint16_t DECIMATION, uint8_t EMA_SHIFT>
+class ADS1115_Filter
+{
+    public:
+        /* Adds a raw result. Returns true if a new output is available (every DECIMATION
+           results). */
+        bool push(int16_t raw){
+            int16_t val = (MEDIAN > 1) ? median.push(raw) : raw;
+            if(DECIMATION > 1){
+                if(!decimator.push(val, val)){
+                    return false;
+                }
+            }
+            output = (EMA_SHIFT > 0) ? ema.push(val) : val;
+            return true;
+        }
+
+        /* Feeds all samples waiting in an acquisition buffer. Returns the number of new outputs. */
+        uint16_t process(ADS1115_SampleBuffer &buf){
+            uint16_t outputs = 0;
+            int16_t raw;
+            while(buf.pop(raw)){
+                if(push(raw)){
+                    outputs++;
+                }
+            }
+            return outputs;
+        }
+
+        /* Latest output */
+        int16_t read(){
+            return output;
+        }
+
+        void reset(){
+            median.reset();
+            decimator.reset();
+            ema.reset();
+            output = 0;
+        }
+
+    protected:
+        ADS1115_Median<(MEDIAN > 1) ? MEDIAN : 1> median;
+        ADS1115_Decimator<(DECIMATION > 1) ? DECIMATION : 1> decimator;
+        ADS1115_EMA<EMA_SHIFT> ema;
+        int16_t output = 0;
+};
+
+template<uint8_t CHANNELS, uint8_t MEDIAN, uint16_t DECIMATION, uint8_t EMA_SHIFT>
+class ADS1115_FilterBank
+{
+    public:
+        bool push(uint8_t channel, int16_t raw){
+            if(channel >= CHANNELS){
+                return false;
+            }
+            return filters[channel].push(raw);
+        }
+
+        int16_t read(uint8_t channel){
+            if(channel >= CHANNELS){
+                return 0;
+            }
+            return filters[channel].read();
+        }
+
+        void reset(){
+            for(uint8_t i=0; i<CHANNELS; i++){
+                filters[i].reset();
+            }
+        }
+
+    protected:
+        ADS1115_Filter<MEDIAN, DECIMATION, EMA_SHIFT> filters[CHANNELS];
+};
+
+#endif
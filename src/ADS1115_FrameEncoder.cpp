@@ -0,0 +1,173 @@
+/*****************************************
+* This is a library for the ADS1115 and ADS1015 A/D Converter
+*
+* You'll find an example which should enable you to use the library.
+*
+* You are free to use it, change it or build on it. In case you like
+* it, it would be cool if you give it a star.
+*
+* If you find bugs, please inform me!
+*
+* Written by Wolfgang (Wolle) Ewald
+* https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+* https://wolles-elektronikkiste.de/ads1115 (German)
+*
+*******************************************/
+
+#include "ADS1115_FrameEncoder.h"
+
+bool ADS1115_FrameEncoder::beginFrame(const uint8_t *sources, uint8_t count, uint32_t timestamp_us, bool delta){
+    if(frameOpen || (count == 0) || (count > ADS1115_FRAME_MAX_CHANNELS)){
+        return false;
+    }
+    /* header, sources, timestamp (max. 5 bytes) and CRC */
+    if((completeLength + 6 + count + 5 + 1) > bufSize){
+        return false;
+    }
+    frameAbsolute = needKeyFrame || (framesSinceKey >= keyFrameInterval);
+    uint8_t flags = (ADS1115_FRAME_VERSION << 4) | (frameAbsolute ? ADS1115_FRAME_ABSOLUTE : 0)
+                    | (delta ? ADS1115_FRAME_DELTA : 0);
+    pos = completeLength;
+    buf[pos++] = ADS1115_FRAME_SYNC;
+    buf[pos++] = flags;
+    buf[pos++] = count;
+    buf[pos++] = 0; // sets, set by endFrame()
+    buf[pos++] = 0; // interval, set by endFrame()
+    buf[pos++] = 0;
+    for(uint8_t i=0; i<count; i++){
+        buf[pos++] = sources[i];
+        previous[i] = 0;
+    }
+    writeVarint(frameAbsolute ? timestamp_us : (timestamp_us - lastFrameTimestamp));
+    setEnd = pos;
+    firstTimestamp = timestamp_us;
+    channels = count;
+    channel = 0;
+    sets = 0;
+    deltaCoding = delta;
+    frameOpen = true;
+    return true;
+}
+
+bool ADS1115_FrameEncoder::addSample(int16_t raw){
+    if(!frameOpen || ((channel == 0) && (sets == 255))){
+        return false;
+    }
+    if(deltaCoding){
+        int32_t diff = int32_t(raw) - previous[channel];
+        uint32_t zigZag = (uint32_t(diff) << 1) ^ uint32_t(diff >> 31);
+        uint8_t bytes = (zigZag < 0x80) ? 1 : ((zigZag < 0x4000) ? 2 : 3);
+        if((pos + bytes + 1) > bufSize){
+            return false;
+        }
+        writeVarint(zigZag);
+        previous[channel] = raw;
+    }
+    else{
+        if((pos + 2 + 1) > bufSize){
+            return false;
+        }
+        buf[pos++] = uint16_t(raw) & 0xFF;
+        buf[pos++] = uint16_t(raw) >> 8;
+    }
+    if(++channel == channels){
+        channel = 0;
+        sets++;
+        setEnd = pos;
+    }
+    return true;
+}
+
+bool ADS1115_FrameEncoder::addSamples(const int16_t *raw, uint8_t n){
+    for(uint8_t i=0; i<n; i++){
+        if(!addSample(raw[i])){
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t ADS1115_FrameEncoder::endFrame(){
+    return endFrame(firstTimestamp);
+}
+
+size_t ADS1115_FrameEncoder::endFrame(uint32_t lastTimestamp_us){
+    if(!frameOpen){
+        return 0;
+    }
+    frameOpen = false;
+    pos = setEnd;
+    if(sets == 0){
+        pos = completeLength;
+        return 0;
+    }
+    size_t start = completeLength;
+    uint32_t interval = 0;
+    if(sets > 1){
+        interval = (lastTimestamp_us - firstTimestamp) / (sets - 1);
+        if(interval > 0xFFFF){
+            interval = 0xFFFF;
+        }
+    }
+    buf[start + 3] = sets;
+    buf[start + 4] = interval & 0xFF;
+    buf[start + 5] = interval >> 8;
+    buf[pos] = crc8(buf + start + 1, pos - start - 1);
+    pos++;
+    completeLength = pos;
+
+    if(frameAbsolute){
+        framesSinceKey = 1;
+        needKeyFrame = false;
+    }
+    else{
+        framesSinceKey++;
+    }
+    lastFrameTimestamp = firstTimestamp;
+    return completeLength - start;
+}
+
+const uint8_t *ADS1115_FrameEncoder::data(){
+    return buf;
+}
+
+size_t ADS1115_FrameEncoder::length(){
+    return completeLength;
+}
+
+void ADS1115_FrameEncoder::clear(){
+    frameOpen = false;
+    completeLength = 0;
+    pos = 0;
+}
+
+void ADS1115_FrameEncoder::setKeyFrameInterval(uint8_t n){
+    keyFrameInterval = n ? n : 1;
+}
+
+void ADS1115_FrameEncoder::resync(){
+    needKeyFrame = true;
+}
+
+/************************************************
+    private functions
+*************************************************/
+
+void ADS1115_FrameEncoder::writeVarint(uint32_t val){
+    while(val >= 0x80){
+        buf[pos++] = (val & 0x7F) | 0x80;
+        val >>= 7;
+    }
+    buf[pos++] = val;
+}
+
+uint8_t ADS1115_FrameEncoder::crc8(const uint8_t *data, size_t len){
+    uint8_t crc = 0;
+    for(size_t i=0; i<len; i++){
+        crc ^= data[i];
+        for(uint8_t bit=0; bit<8; bit++){
+            crc = (crc & 0x80) ? ((crc << 1) ^ 0x07) : (crc << 1);
+        }
+    }
+    return crc;
+}
@@ -0,0 +1,110 @@
+/******************************************************************************
+ *
+ * This is a library for the ADS1115 and ADS1015 A/D Converter
+ *
+ * ADS1115_FrameEncoder packs raw results into compact binary frames, e.g. to
+ * stream them via Serial.write() instead of printing floats. The frames are
+ * written directly into a buffer you provide, without copies. A frame contains
+ * sets of samples of 1 to 8 channels (interleaved: set 0 channel 0..n-1, set 1
+ * channel 0..n-1, ...):
+ *
+ * byte 0       sync byte 0xA5
+ * byte 1       flags: bit 0 = delta coding, bit 1 = absolute timestamp,
+ *              bits 4-7 = format version (1)
+ * byte 2       number of channels n
+ * byte 3       number of sets
+ * byte 4, 5    interval between two sets in µs (little endian), 0 = unknown
+ * n bytes      source of each channel: bits 0-2 mux code (mux >> 12),
+ *              bits 3-5 range code (range >> 9), bits 6-7 device (0-3)
+ * varint       timestamp of the first set in µs: absolute (micros()) or the
+ *              difference to the previous frame
+ * samples      raw: int16_t, little endian; delta coding: difference to the
+ *              previous sample of the same channel (first one: to 0),
+ *              zig-zag coded as varint (1 byte for differences of -64...63)
+ * byte         CRC-8 (polynomial 0x07) of all bytes from byte 1
+ *
+ * Varints are little endian base 128 (7 bits per byte, bit 7 = more bytes).
+ * Every keyFrameInterval-th frame has an absolute timestamp, so a receiver can
+ * synchronize after lost frames. A decoder for the host is in extras/host.
+ *
+ * Example: 4 channels, 16 sets per frame, raw: 142 bytes for 64 samples.
+ *
+ * Written by Wolfgang (Wolle) Ewald
+ * https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+ * https://wolles-elektronikkiste.de/ads1115 (German)
+ *
+ ******************************************************************************/
+
+#ifndef ADS1115_FRAME_ENCODER_H_
+#define ADS1115_FRAME_ENCODER_H_
+
+#include "ADS1115_WE.h"
+
+class ADS1115_FrameEncoder
+{
+    public:
+        static constexpr uint8_t ADS1115_FRAME_SYNC         {0xA5};
+        static constexpr uint8_t ADS1115_FRAME_VERSION      {1};
+        static constexpr uint8_t ADS1115_FRAME_DELTA        {0x01};
+        static constexpr uint8_t ADS1115_FRAME_ABSOLUTE     {0x02};
+        static constexpr uint8_t ADS1115_FRAME_MAX_CHANNELS {8};
+
+        /* Source byte of a channel, e.g. const uint8_t sources[] = {
+         * ADS1115_FrameEncoder::source(ADS1115_COMP_0_GND, ADS1115_RANGE_4096), ...}; */
+        static constexpr uint8_t source(ADS1115_MUX mux, ADS1115_RANGE range, uint8_t device = 0){
+            return ((mux >> 12) & 7) | (((range >> 9) & 7) << 3) | ((device & 3) << 6);
+        }
+
+        ADS1115_FrameEncoder(uint8_t *buffer, size_t size) : buf{buffer}, bufSize{size} {}
+
+        /* Starts a frame behind the frames already in the buffer. The sources are copied.
+         * Returns false if a frame is open, count is invalid or the buffer is too full. */
+        bool beginFrame(const uint8_t *sources, uint8_t count, uint32_t timestamp_us, bool delta = false);
+
+        /* Adds the next sample in channel order. Returns false if the buffer is full or the
+         * frame has 255 sets; then end the frame and start a new one. */
+        bool addSample(int16_t raw);
+        bool addSamples(const int16_t *raw, uint8_t n);
+
+        /* Completes the frame (sets, interval and CRC). Incomplete sets are removed. With
+         * lastTimestamp_us (time of the last set), the interval between the sets is stored.
+         * Returns the size of the frame, 0 if it was empty (then it is removed). */
+        size_t endFrame();
+        size_t endFrame(uint32_t lastTimestamp_us);
+
+        /* Complete frames in the buffer, e.g. Serial.write(encoder.data(), encoder.length()) */
+        const uint8_t *data();
+        size_t length();
+
+        /* Empties the buffer (an open frame is discarded) */
+        void clear();
+
+        /* Every n-th frame gets an absolute timestamp (default 16, 1 = every frame) */
+        void setKeyFrameInterval(uint8_t n);
+
+        /* The next frame gets an absolute timestamp, e.g. after data was lost */
+        void resync();
+
+    protected:
+        uint8_t *buf;
+        size_t bufSize;
+        size_t completeLength = 0;  // end of the last complete frame
+        size_t pos = 0;             // write position in the open frame
+        size_t setEnd = 0;          // end of the last complete set
+        bool frameOpen = false;
+        bool frameAbsolute = false;
+        bool deltaCoding = false;
+        uint8_t channels = 0;
+        uint8_t channel = 0;        // channel of the next sample
+        uint8_t sets = 0;
+        uint32_t firstTimestamp = 0;
+        uint32_t lastFrameTimestamp = 0;
+        uint8_t keyFrameInterval = 16;
+        uint8_t framesSinceKey = 0;
+        bool needKeyFrame = true;
+        int16_t previous[ADS1115_FRAME_MAX_CHANNELS] = {0};
+        void writeVarint(uint32_t val);
+        static uint8_t crc8(const uint8_t *data, size_t len);
+};
+
+#endif
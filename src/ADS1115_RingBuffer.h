@@ -0,0 +1,127 @@
+/******************************************************************************
+ *
+ * This is a library for the ADS1115 and ADS1015 A/D Converter
+ *
+ * Lock-free single producer / single consumer ring buffer for raw samples. The
+ * producer (e.g. an interrupt service routine) only writes the head index, the
+ * consumer (e.g. loop()) only writes the tail index. No heap is used, the storage
+ * is part of the ADS1115_RingBuffer<CAPACITY> object.
+ *
+ * Written by Wolfgang (Wolle) Ewald
+ * https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+ * https://wolles-elektronikkiste.de/ads1115 (German)
+ *
+ ******************************************************************************/
+
+#ifndef ADS1115_RING_BUFFER_H_
+#define ADS1115_RING_BUFFER_H_
+
+#if (ARDUINO >= 100)
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+
+class ADS1115_SampleBuffer
+{
+    public:
+        /* Producer side: returns false if the buffer is full (the sample is dropped) */
+        bool push(int16_t sample){
+            uint16_t h = head;
+            if((uint16_t)(h - loadIndex(tail)) >= size){
+                return false;
+            }
+            buf[h & mask] = sample;
+            storeIndex(head, h + 1);
+            return true;
+        }
+
+        /* Consumer side: returns false if the buffer is empty */
+        bool pop(int16_t &sample){
+            uint16_t t = tail;
+            if(t == loadIndex(head)){
+                return false;
+            }
+            sample = buf[t & mask];
+            storeIndex(tail, t + 1);
+            return true;
+        }
+
+        /* Consumer side: copies up to maxCount samples to dst and returns their number */
+        uint16_t read(int16_t *dst, uint16_t maxCount){
+            uint16_t t = tail;
+            uint16_t count = loadIndex(head) - t;
+            if(count > maxCount){
+                count = maxCount;
+            }
+            for(uint16_t i=0; i<count; i++){
+                dst[i] = buf[(t + i) & mask];
+            }
+            storeIndex(tail, t + count);
+            return count;
+        }
+
+        uint16_t available(){
+            return loadIndex(head) - loadIndex(tail);
+        }
+
+        uint16_t capacity(){
+            return size;
+        }
+
+        /* Consumer side: discards all samples */
+        void clear(){
+            storeIndex(tail, loadIndex(head));
+        }
+
+    protected:
+        ADS1115_SampleBuffer(int16_t *storage, uint16_t capacity) :
+            buf{storage}, size{capacity}, mask{static_cast<uint16_t>(capacity - 1)} {}
+
+        /* Indices run freely and are only masked on access. On AVR a 16-bit access
+         * is not atomic, therefore interrupts are blocked for the access. */
+        static uint16_t loadIndex(volatile uint16_t &idx){
+#ifdef __AVR__
+            uint8_t sreg = SREG;
+            cli();
+            uint16_t val = idx;
+            SREG = sreg;
+            return val;
+#else
+            return __atomic_load_n(&idx, __ATOMIC_ACQUIRE);
+#endif
+        }
+
+        static void storeIndex(volatile uint16_t &idx, uint16_t val){
+#ifdef __AVR__
+            uint8_t sreg = SREG;
+            cli();
+            idx = val;
+            SREG = sreg;
+#else
+            __atomic_store_n(&idx, val, __ATOMIC_RELEASE);
+#endif
+        }
+
+        int16_t *buf;
+        uint16_t size;
+        uint16_t mask;
+        volatile uint16_t head = 0;
+        volatile uint16_t tail = 0;
+};
+
+/* CAPACITY must be a power of two, e.g. ADS1115_RingBuffer<64> buffer; */
+template<uint16_t CAPACITY>
+class ADS1115_RingBuffer : public ADS1115_SampleBuffer
+{
+    static_assert((CAPACITY >= 2) && ((CAPACITY & (CAPACITY - 1)) == 0) && (CAPACITY <= 32768),
+                  "CAPACITY must be a power of two between 2 and 32768");
+
+    public:
+        ADS1115_RingBuffer() : ADS1115_SampleBuffer(storage, CAPACITY) {}
+
+    private:
+        int16_t storage[CAPACITY];
+};
+
+#endif
@@ -0,0 +1,152 @@
+/*****************************************
+* This is a library for the ADS1115 and ADS1015 A/D Converter
+*
+* You'll find an example which should enable you to use the library.
+*
+* You are free to use it, change it or build on it. In case you like
+* it, it would be cool if you give it a star.
+*
+* If you find bugs, please inform me!
+*
+* Written by Wolfgang (Wolle) Ewald
+* https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+* https://wolles-elektronikkiste.de/ads1115 (German)
+*
+*******************************************/
+
+#include "ADS1115_Scanner.h"
+
+bool ADS1115_Scanner::begin(const ADS1115_MUX *list, uint8_t count, bool useReadyPin){
+    muxList = list;
+    entryList = nullptr;
+    return start(count, useReadyPin);
+}
+
+bool ADS1115_Scanner::begin(const ADS1115_ScanEntry *table, uint8_t count, bool useReadyPin){
+    muxList = nullptr;
+    entryList = table;
+    return start(count, useReadyPin);
+}
+
+void ADS1115_Scanner::stop(){
+    running = false;
+}
+
+void ADS1115_Scanner::onConversionReady(){
+    convReady = true;
+}
+
+bool ADS1115_Scanner::update(){
+    if(!running){
+        return false;
+    }
+    if(readyPin){
+        if(!convReady){
+            restartIfOverdue();
+            return false;
+        }
+        convReady = false;
+    }
+    else if(!adc.isConvDue()){ // no I2C access before the conversion can be completed
+        return false;
+    }
+    else if(adc.isBusy()){
+        restartIfOverdue();
+        return false;
+    }
+
+    rawResults[currentEntry] = adc.getRawResult();
+    voltageRanges[currentEntry] = adc.getVoltageRange_mV();
+
+    bool scanCompleted = false;
+    currentEntry++;
+    if(currentEntry >= entries){
+        currentEntry = 0;
+        scanCount++;
+        scanCompleted = true;
+    }
+    startConversion();
+    return scanCompleted;
+}
+
+int16_t ADS1115_Scanner::getRawResult(uint8_t entry){
+    if(entry >= entries){
+        return 0;
+    }
+    return rawResults[entry];
+}
+
+#ifndef ADS1115_NO_FLOAT
+float ADS1115_Scanner::getResult_mV(uint8_t entry){
+    if(entry >= entries){
+        return 0.0;
+    }
+    return (static_cast<int32_t>(rawResults[entry]) * voltageRanges[entry] * 2) / 65536.0;
+}
+#endif
+
+int32_t ADS1115_Scanner::getResult_uV(uint8_t entry){
+    if(entry >= entries){
+        return 0;
+    }
+    return ADS1115_WE::rawToMicrovolts(rawResults[entry], voltageRanges[entry] >> 8);
+}
+
+#ifndef ADS1115_NO_FLOAT
+float ADS1115_Scanner::getResult_V(uint8_t entry){
+    return getResult_mV(entry) / 1000;
+}
+#endif
+
+uint32_t ADS1115_Scanner::getScanCount(){
+    return scanCount;
+}
+
+uint32_t ADS1115_Scanner::getTimeouts(){
+    return timeouts;
+}
+
+/************************************************ 
+    private functions
+*************************************************/
+
+bool ADS1115_Scanner::start(uint8_t count, bool useReadyPin){
+    if((count == 0) || (count > ADS1115_SCAN_MAX_ENTRIES)){
+        return false;
+    }
+    entries = count;
+    currentEntry = 0;
+    timeouts = 0;
+    readyPin = useReadyPin;
+    convReady = false;
+
+    adc.beginConfig();
+    adc.setMeasureMode(ADS1115_SINGLE);
+    if(readyPin){
+        adc.setAlertPinMode(ADS1115_ASSERT_AFTER_1);
+        adc.setAlertPinToConversionReady();
+    }
+    adc.commitConfig();
+
+    running = true;
+    startConversion();
+    return true;
+}
+
+void ADS1115_Scanner::startConversion(){
+    if(entryList){
+        adc.startSingleMeasurement(entryList[currentEntry]);
+    }
+    else{
+        adc.startSingleMeasurement(muxList[currentEntry]);
+    }
+}
+
+/* Missed ready interrupt or failed start (e.g. NACK): the current entry is measured again */
+void ADS1115_Scanner::restartIfOverdue(){
+    if(adc.isConvOverdue()){
+        timeouts++;
+        convReady = false;
+        startConversion();
+    }
+}
@@ -0,0 +1,82 @@
+/******************************************************************************
+ *
+ * This is a library for the ADS1115 and ADS1015 A/D Converter
+ *
+ * ADS1115_Scanner measures a list of channels round robin in single shot mode
+ * without any delay. Call update() as often as possible (or after the conversion
+ * ready interrupt). It switches the channel (or the scan table entry), starts the
+ * next conversion and collects the result whenever a conversion is finished.
+ *
+ * Written by Wolfgang (Wolle) Ewald
+ * https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+ * https://wolles-elektronikkiste.de/ads1115 (German)
+ *
+ ******************************************************************************/
+
+#ifndef ADS1115_SCANNER_H_
+#define ADS1115_SCANNER_H_
+
+#include "ADS1115_WE.h"
+
+class ADS1115_Scanner
+{
+    public:
+        static constexpr uint8_t ADS1115_SCAN_MAX_ENTRIES {8};
+
+        ADS1115_Scanner(ADS1115_WE &ads) : adc{ads} {}
+
+        /* Starts scanning. The list is not copied, it has to exist as long as the scan runs.
+         * Up to ADS1115_SCAN_MAX_ENTRIES entries. Range and rate have to be set before.
+         *
+         * useReadyPin = false -> update() polls the conversion state via I2C (isBusy()), but
+         *                        not before the conversion can be completed (isConvDue())
+         * useReadyPin = true  -> the alert pin is set to conversion ready, your interrupt
+         *                        service routine has to call onConversionReady()
+         */
+        bool begin(const ADS1115_MUX *list, uint8_t count, bool useReadyPin = false);
+
+        /* Same with a scan table: each entry has its own channel, range and rate, which are
+         * switched together with the start of the conversion (one register write). */
+        bool begin(const ADS1115_ScanEntry *table, uint8_t count, bool useReadyPin = false);
+        void stop();
+
+        /* Call this function from your interrupt service routine (RDY edge) */
+        void onConversionReady();
+
+        /* Non-blocking state machine step. Returns true if a scan has been completed. */
+        bool update();
+
+        /* Latest results per list entry */
+        int16_t getRawResult(uint8_t entry);
+#ifndef ADS1115_NO_FLOAT
+        float getResult_mV(uint8_t entry);
+        float getResult_V(uint8_t entry);
+#endif
+        int32_t getResult_uV(uint8_t entry);
+
+        /* Number of completed scans, incremented each time the last entry has been read */
+        uint32_t getScanCount();
+
+        /* Conversions which were not completed in time (3 x maximum conversion time, e.g. missed 
+         * ready interrupt or failed start). The entry is measured again. Reset by begin(). */
+        uint32_t getTimeouts();
+
+    protected:
+        ADS1115_WE &adc;
+        const ADS1115_MUX *muxList = nullptr;
+        const ADS1115_ScanEntry *entryList = nullptr;
+        uint8_t entries = 0;
+        uint8_t currentEntry = 0;
+        bool running = false;
+        bool readyPin = false;
+        volatile bool convReady = false;
+        uint32_t scanCount = 0;
+        uint32_t timeouts = 0;
+        int16_t rawResults[ADS1115_SCAN_MAX_ENTRIES] = {0};
+        uint16_t voltageRanges[ADS1115_SCAN_MAX_ENTRIES] = {0};
+        bool start(uint8_t count, bool useReadyPin);
+        void startConversion();
+        void restartIfOverdue();
+};
+
+#endif
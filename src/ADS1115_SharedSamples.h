@@ -0,0 +1,178 @@
+/******************************************************************************
+ *
+ * This is a library for the ADS1115 and ADS1015 A/D Converter
+ *
+ * ADS1115_SharedSamples<ENTRIES> publishes the latest set of samples of one
+ * writer (e.g. ADS1115_AcquisitionTask) to any number of readers in other tasks
+ * or interrupt service routines, without locks. The sets are double buffered:
+ * the writer fills the buffer which is not published and then switches. Each
+ * buffer has a sequence number (odd while being written), so a reader notices if
+ * the writer has overwritten the buffer during the copy and simply repeats it.
+ * Readers never wait for a writer which has been interrupted in the middle of a
+ * set, so there is no priority inversion.
+ *
+ * Written by Wolfgang (Wolle) Ewald
+ * https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+ * https://wolles-elektronikkiste.de/ads1115 (German)
+ *
+ ******************************************************************************/
+
+#ifndef ADS1115_SHARED_SAMPLES_H_
+#define ADS1115_SHARED_SAMPLES_H_
+
+#include "ADS1115_WE.h"
+
+class ADS1115_SampleBoard
+{
+    public:
+        /* Writer side (one task only): publishes count samples (at most capacity()) and the
+         * time they were completed. */
+        void publish(const ADS1115_Sample *samples, uint8_t count, uint32_t timestamp){
+            uint8_t b = active ^ 1;
+            uint32_t seq = seqs[b];
+            storeWord(seqs[b], seq + 1, false); // odd: buffer b is being written
+#ifndef __AVR__
+            __atomic_thread_fence(__ATOMIC_RELEASE);
+#endif
+            volatile uint32_t *words = storage + b * size;
+            for(uint8_t i=0; i<size; i++){
+                uint32_t word = 0;
+                if(i < count){
+                    word = static_cast<uint16_t>(samples[i].raw) | (static_cast<uint32_t>(samples[i].range) << 16);
+                }
+                storeWord(words[i], word, false);
+            }
+            storeWord(stamps[b], timestamp, false);
+            storeWord(sets[b], sets[active] + 1, false);
+            storeWord(seqs[b], seq + 2, true);
+            storeActive(b);
+        }
+
+        /* Reader side (any task): copies the latest set (up to count samples) and optionally
+         * its timestamp. Returns the number of the set (1, 2, 3, ...), 0 if nothing has been
+         * published yet. */
+        uint32_t read(ADS1115_Sample *samples, uint8_t count, uint32_t *timestamp = nullptr){
+            if(count > size){
+                count = size;
+            }
+            for(;;){
+                uint8_t b = loadActive();
+                uint32_t seq = loadWord(seqs[b], true);
+                if(seq & 1){
+                    continue; // the writer has switched in the meantime
+                }
+                volatile uint32_t *words = storage + b * size;
+                for(uint8_t i=0; i<count; i++){
+                    uint32_t word = loadWord(words[i], false);
+                    samples[i].raw = static_cast<int16_t>(word & 0xFFFF);
+                    samples[i].range = static_cast<ADS1115_RANGE>(word >> 16);
+                }
+                uint32_t stamp = loadWord(stamps[b], false);
+                uint32_t set = loadWord(sets[b], false);
+#ifndef __AVR__
+                __atomic_thread_fence(__ATOMIC_ACQUIRE);
+#endif
+                if(loadWord(seqs[b], false) == seq){
+                    if(timestamp){
+                        *timestamp = stamp;
+                    }
+                    return set;
+                }
+            }
+        }
+
+        /* Reader side: latest sample of one entry */
+        bool read(uint8_t entry, ADS1115_Sample &sample){
+            ADS1115_Sample samples[ADS1115_SAMPLE_BOARD_MAX_ENTRIES];
+            if((entry >= size) || !read(samples, entry + 1)){
+                return false;
+            }
+            sample = samples[entry];
+            return true;
+        }
+
+        /* Number of the latest set, 0 = nothing published yet */
+        uint32_t getSetCount(){
+            return loadWord(sets[loadActive()], true);
+        }
+
+        uint8_t capacity(){
+            return size;
+        }
+
+        static constexpr uint8_t ADS1115_SAMPLE_BOARD_MAX_ENTRIES {8};
+
+    protected:
+        ADS1115_SampleBoard(volatile uint32_t *buffers, uint8_t entries) :
+            storage{buffers}, size{entries} {}
+
+        /* On AVR a 32-bit access is not atomic, therefore interrupts are blocked for the access */
+        static uint32_t loadWord(volatile uint32_t &word, bool acquire){
+#ifdef __AVR__
+            (void)acquire;
+            uint8_t sreg = SREG;
+            cli();
+            uint32_t val = word;
+            SREG = sreg;
+            return val;
+#else
+            return acquire ? __atomic_load_n(&word, __ATOMIC_ACQUIRE) : __atomic_load_n(&word, __ATOMIC_RELAXED);
+#endif
+        }
+
+        static void storeWord(volatile uint32_t &word, uint32_t val, bool release){
+#ifdef __AVR__
+            (void)release;
+            uint8_t sreg = SREG;
+            cli();
+            word = val;
+            SREG = sreg;
+#else
+            if(release){
+                __atomic_store_n(&word, val, __ATOMIC_RELEASE);
+            }
+            else{
+                __atomic_store_n(&word, val, __ATOMIC_RELAXED);
+            }
+#endif
+        }
+
+        uint8_t loadActive(){
+#ifdef __AVR__
+            return active;
+#else
+            return __atomic_load_n(&active, __ATOMIC_ACQUIRE);
+#endif
+        }
+
+        void storeActive(uint8_t b){
+#ifdef __AVR__
+            active = b;
+#else
+            __atomic_store_n(&active, b, __ATOMIC_RELEASE);
+#endif
+        }
+
+        volatile uint32_t *storage;     // two buffers of size words: raw | range << 16
+        uint8_t size;
+        volatile uint8_t active = 0;    // buffer with the latest complete set
+        volatile uint32_t seqs[2] = {0, 0};
+        volatile uint32_t stamps[2] = {0, 0};
+        volatile uint32_t sets[2] = {0, 0};
+};
+
+/* ENTRIES: samples per set (1 to 8), e.g. ADS1115_SharedSamples<4> latest; */
+template<uint8_t ENTRIES>
+class ADS1115_SharedSamples : public ADS1115_SampleBoard
+{
+    static_assert((ENTRIES >= 1) && (ENTRIES <= ADS1115_SAMPLE_BOARD_MAX_ENTRIES),
+                  "ENTRIES must be between 1 and 8");
+
+    public:
+        ADS1115_SharedSamples() : ADS1115_SampleBoard(storage, ENTRIES) {}
+
+    private:
+        volatile uint32_t storage[2 * ENTRIES] = {0};
+};
+
+#endif
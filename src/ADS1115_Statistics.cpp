@@ -0,0 +1,63 @@
+/*****************************************
+* This is a library for the ADS1115 and ADS1015 A/D Converter
+*
+* You'll find an example which should enable you to use the library.
+*
+* You are free to use it, change it or build on it. In case you like
+* it, it would be cool if you give it a star.
+*
+* If you find bugs, please inform me!
+*
+* Written by Wolfgang (Wolle) Ewald
+* https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+* https://wolles-elektronikkiste.de/ads1115 (German)
+*
+*******************************************/
+
+#include "ADS1115_Statistics.h"
+
+#ifndef ADS1115_NO_STATISTICS // nothing to link, no float math
+
+ADS1115_ChannelStats ADS1115_Statistics::snapshot(){
+    ADS1115_ChannelStats result;
+    result.count = count;
+    if(count == 0){
+        return result;
+    }
+    /* sum^2 / count = q^2 * count + 2 * q * r + r^2 / count with |sum| = q * count + r. All terms 
+       are positive and not greater than sumSq (sum^2 / count <= sumSq), so the calculation in 
+       uint64_t does not overflow before sumSq does. Only r^2 / count is truncated (less than one 
+       unit), which is negligible compared to the float conversion below. */
+    uint64_t absSum = (sum < 0) ? -sum : sum;
+    uint64_t q = absSum / count;
+    uint64_t r = absSum % count;
+    uint64_t sqDevs = sumSq - (q * q * count + 2 * q * r + (r * r) / count);
+    const float lsb_mV = 1.0 / 128.0; // 7.8125 µV
+    float absMean = q + static_cast<float>(r) / count;
+    result.min_mV = minVal * lsb_mV;
+    result.max_mV = maxVal * lsb_mV;
+    result.mean_mV = ((sum < 0) ? -absMean : absMean) * lsb_mV;
+    result.stdDev_mV = sqrt(static_cast<float>(sqDevs) / count) * lsb_mV;
+    result.rms_mV = sqrt(static_cast<float>(sumSq) / count) * lsb_mV;
+    return result;
+}
+
+ADS1115_ChannelStats ADS1115_Statistics::snapshotAndReset(){
+    ADS1115_ChannelStats result = snapshot();
+    reset();
+    return result;
+}
+
+void ADS1115_Statistics::reset(){
+    count = 0;
+    sum = 0;
+    sumSq = 0;
+    minVal = INT32_MAX;
+    maxVal = INT32_MIN;
+}
+
+uint32_t ADS1115_Statistics::getCount(){
+    return count;
+}
+
+#endif
@@ -0,0 +1,76 @@
+/******************************************************************************
+ *
+ * This is a library for the ADS1115 and ADS1015 A/D Converter
+ *
+ * ADS1115_Statistics accumulates count, minimum, maximum, sum and sum of squares
+ * of results without storing them. The results are converted into units of 
+ * 7.8125 µV (one LSB in the 256 mV range) by multiplying with the range factor, 
+ * so results of different ranges can be mixed. add() only uses integer 
+ * arithmetic, floating point is only used by snapshot(). 
+ *
+ * Limit: the sum of squares overflows after about 29 million results at full 
+ * scale in the 6144 mV range (about 9 hours at 860 SPS). 
+ * Not available with ADS1115_NO_STATISTICS (e.g. tiny profile), then nothing 
+ * of it is compiled or linked.
+ *
+ * Written by Wolfgang (Wolle) Ewald
+ * https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+ * https://wolles-elektronikkiste.de/ads1115 (German)
+ *
+ ******************************************************************************/
+
+#ifndef ADS1115_STATISTICS_H_
+#define ADS1115_STATISTICS_H_
+
+#include "ADS1115_WE.h"
+
+#ifndef ADS1115_NO_STATISTICS
+
+struct ADS1115_ChannelStats {
+    uint32_t count = 0;
+    float min_mV = 0.0;
+    float max_mV = 0.0;
+    float mean_mV = 0.0;
+    float stdDev_mV = 0.0;     // population standard deviation (AC RMS)
+    float rms_mV = 0.0;        // including the mean (DC + AC)
+};
+
+class ADS1115_Statistics
+{
+    public:
+        void add(int16_t raw, ADS1115_RANGE range){
+            uint8_t factor = ADS1115_WE::rangeFactor(range);
+            int32_t val = static_cast<int32_t>(raw) * factor;
+            uint32_t rawSq = static_cast<int32_t>(raw) * raw;
+            count++;
+            sum += val;
+            sumSq += static_cast<uint64_t>(rawSq) * (factor * factor);
+            if(val < minVal){
+                minVal = val;
+            }
+            if(val > maxVal){
+                maxVal = val;
+            }
+        }
+
+        void add(const ADS1115_Sample &sample){
+            add(sample.raw, sample.range);
+        }
+
+        /* Converts the accumulated values into millivolts */
+        ADS1115_ChannelStats snapshot();
+        ADS1115_ChannelStats snapshotAndReset();
+        void reset();
+        uint32_t getCount();
+
+    protected:
+        uint32_t count = 0;
+        int64_t sum = 0;            // in units of 7.8125 µV
+        uint64_t sumSq = 0;         // in units of (7.8125 µV)^2
+        int32_t minVal = INT32_MAX;
+        int32_t maxVal = INT32_MIN;
+};
+
+#endif // ADS1115_NO_STATISTICS
+
+#endif
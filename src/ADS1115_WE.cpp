@@ -15,100 +15,176 @@
 *******************************************/
 
 #include "ADS1115_WE.h"
+#include "ADS1115_Statistics.h"
+#ifdef __AVR__
+ #include <avr/sleep.h>
+#endif
 
 void ADS1115_WE::reset(){
+#ifndef ADS1115_NO_HS_MODE
+    endHsSession(); // the general call would end the Hs-mode anyway
+#endif
+    lockBus();
+#ifdef ADS1115_ENABLE_STATS
+    unsigned long startTime = micros();
+#endif
 #ifndef USE_TINY_WIRE_M_  
     _wire->beginTransmission(0);
     _wire->write(0x06);
-    _wire->endTransmission();
+    uint8_t err = _wire->endTransmission();
 #else
     TinyWireM.beginTransmission(0);
     TinyWireM.send(0x06);
-    TinyWireM.endTransmission();
+    uint8_t err = TinyWireM.endTransmission();
+#endif
+#ifdef ADS1115_ENABLE_STATS
+    stats.resets++;
+    recordTransaction(2, err, micros() - startTime);
+#else
+    (void)err;
 #endif
+    unlockBus();
+    /* the general call reset sets all registers to their default values */
+    pointerReg = ADS1115_NO_REG;
+    confRegShadow = ADS1115_REG_RESET_VAL & ~(0x8000);
+    loThreshShadow = 0x8000;
+    hiThreshShadow = 0x7FFF;
+    voltageRange = 2048;
+    convConfig = confRegShadow;
+    rangeSettling = false;
 }
 
 bool ADS1115_WE::init(bool ads1015){
-    useADS1015 = ads1015;
+    selectChip(ads1015 ? ADS1015_CHIP : ADS1115_CHIP);
 
     if(isDisconnected()){
         return 0;
     }
-    writeRegister(ADS1115_CONFIG_REG, ADS1115_REG_RESET_VAL);
-    setVoltageRange_mV(ADS1115_RANGE_2048);
+    /* The reset value already selects the 2048 mV range and single shot mode */
+    writeRegister(ADS1115_CONFIG_REG, ADS1115_REG_RESET_VAL & ~(0x8000)); // without starting a conversion
     writeRegister(ADS1115_LO_THRESH_REG, 0x8000);
     writeRegister(ADS1115_HI_THRESH_REG, 0x7FFF);
-    setMeasureMode(ADS1115_SINGLE);
+    voltageRange = 2048;
     autoRangeMode = false;
     rememberChannelRanges = false;
-    return 1;
+    return resyncFromDevice();
+}
+
+bool ADS1115_WE::resyncFromDevice(){
+    pointerReg = ADS1115_NO_REG;
+    lockBus();
+    uint16_t devConfReg = readRegister(ADS1115_CONFIG_REG) & ~(0x8000); // OS bit is status, not config
+    bool readOk = (pointerReg != ADS1115_NO_REG); // a failed read resets the pointer register copy
+    uint16_t devLoThresh = readRegister(ADS1115_LO_THRESH_REG);
+    readOk = readOk && (pointerReg != ADS1115_NO_REG);
+    uint16_t devHiThresh = readRegister(ADS1115_HI_THRESH_REG);
+    readOk = readOk && (pointerReg != ADS1115_NO_REG);
+    unlockBus();
+    if(!readOk){ // keep the copies
+        return false;
+    }
+    bool inSync = (devConfReg == confRegShadow) && (devLoThresh == loThreshShadow) 
+                  && (devHiThresh == hiThreshShadow);
+    
+    confRegShadow = devConfReg;
+    loThreshShadow = devLoThresh;
+    hiThreshShadow = devHiThresh;
+    voltageRange = rangeToMillivolts(getRange());
+    return inSync;
+}
+
+ADS1X15_CHIP ADS1115_WE::getChip(){
+    return useADS1015 ? ADS1015_CHIP : ADS1115_CHIP;
 }
 
 uint8_t ADS1115_WE::isDisconnected(){
+    lockBus();
+#ifdef ADS1115_ENABLE_STATS
+    unsigned long startTime = micros();
+#endif
 #ifndef USE_TINY_WIRE_M_
     _wire->beginTransmission(i2cAddress);
-    uint8_t success = _wire->endTransmission();
+    uint8_t success = _wire->endTransmission(!hsSession);
 #else
     TinyWireM.beginTransmission(i2cAddress);
     uint8_t success = TinyWireM.endTransmission();
 #endif
+#ifdef ADS1115_ENABLE_STATS
+    stats.connectionChecks++;
+    recordTransaction(1, success, micros() - startTime);
+#endif
+    unlockBus();
+    if(success){
+        pointerReg = ADS1115_NO_REG;  // device might have been reset
+    }
     return success;
 }
 
 void ADS1115_WE::setAlertPinMode(ADS1115_COMP_QUE mode){
-    uint16_t currentConfReg = readRegister(ADS1115_CONFIG_REG);
+    uint16_t currentConfReg = confRegShadow;
     currentConfReg &= ~(0x8003);    
     currentConfReg |= mode;
-    writeRegister(ADS1115_CONFIG_REG, currentConfReg);
+    writeConfReg(currentConfReg);
 }
 
 void ADS1115_WE::setAlertLatch(ADS1115_LATCH latch){
-    uint16_t currentConfReg = readRegister(ADS1115_CONFIG_REG);
+    uint16_t currentConfReg = confRegShadow;
     currentConfReg &= ~(0x8004);    
     currentConfReg |= latch;
-    writeRegister(ADS1115_CONFIG_REG, currentConfReg);
+    writeConfReg(currentConfReg);
 }
 
 void ADS1115_WE::setAlertPol(ADS1115_ALERT_POL polarity){
-    uint16_t currentConfReg = readRegister(ADS1115_CONFIG_REG);
+    uint16_t currentConfReg = confRegShadow;
     currentConfReg &= ~(0x8008);    
     currentConfReg |= polarity;
-    writeRegister(ADS1115_CONFIG_REG, currentConfReg);
+    writeConfReg(currentConfReg);
 }
 
+#ifndef ADS1115_NO_FLOAT
 void ADS1115_WE::setAlertModeAndLimit_V(ADS1115_COMP_MODE mode, float hiThres, float loThres){
-    uint16_t currentConfReg = readRegister(ADS1115_CONFIG_REG);
+    uint16_t currentConfReg = confRegShadow;
     currentConfReg &= ~(0x8010);    
     currentConfReg |= mode;
-    writeRegister(ADS1115_CONFIG_REG, currentConfReg);
+    writeConfReg(currentConfReg);
     int16_t alertLimit = calcLimit(hiThres);
-    writeRegister(ADS1115_HI_THRESH_REG, alertLimit);
+    writeThreshReg(ADS1115_HI_THRESH_REG, alertLimit);
     alertLimit = calcLimit(loThres);
-    writeRegister(ADS1115_LO_THRESH_REG, alertLimit);
+    writeThreshReg(ADS1115_LO_THRESH_REG, alertLimit);
     
 }
+#endif
+
+void ADS1115_WE::setAlertModeAndLimit_raw(ADS1115_COMP_MODE mode, int16_t hiThres, int16_t loThres){
+    uint16_t currentConfReg = confRegShadow;
+    currentConfReg &= ~(0x8010);    
+    currentConfReg |= mode;
+    writeConfReg(currentConfReg);
+    writeThreshReg(ADS1115_HI_THRESH_REG, hiThres);
+    writeThreshReg(ADS1115_LO_THRESH_REG, loThres);
+}
 
 void ADS1115_WE::setConvRate(ADS1115_CONV_RATE rate){
-    uint16_t currentConfReg = readRegister(ADS1115_CONFIG_REG);
+    uint16_t currentConfReg = confRegShadow;
     currentConfReg &= ~(0x80E0);    
     currentConfReg |= rate;
-    writeRegister(ADS1115_CONFIG_REG, currentConfReg);
+    writeConfReg(currentConfReg);
 }
 
 convRate ADS1115_WE::getConvRate(){
-    uint16_t currentConfReg = readRegister(ADS1115_CONFIG_REG);
+    uint16_t currentConfReg = confRegShadow;
     return (convRate)(currentConfReg & 0xE0);
 }
     
 void ADS1115_WE::setMeasureMode(ADS1115_MEASURE_MODE mode){
-    uint16_t currentConfReg = readRegister(ADS1115_CONFIG_REG);
+    uint16_t currentConfReg = confRegShadow;
     currentConfReg &= ~(0x8100);    
     currentConfReg |= mode;
-    writeRegister(ADS1115_CONFIG_REG, currentConfReg);
+    writeConfReg(currentConfReg);
 }
 
 ADS1115_MEASURE_MODE ADS1115_WE::getMeasureMode(){
-    uint16_t currentConfReg = readRegister(ADS1115_CONFIG_REG);
+    uint16_t currentConfReg = confRegShadow;
     if (currentConfReg & 0x0100) {
         return ADS1115_SINGLE;
     }
@@ -119,50 +195,64 @@ ADS1115_MEASURE_MODE ADS1115_WE::getMeasureMode(){
 void ADS1115_WE::setVoltageRange_mV(ADS1115_RANGE range){
     ADS1115_MEASURE_MODE currentMeasureMode = getMeasureMode();
     uint16_t currentVoltageRange = voltageRange;
-    uint16_t currentConfReg = readRegister(ADS1115_CONFIG_REG);
+    uint16_t currentConfReg = confRegShadow;
     ADS1115_RANGE currentRange = getRange();
     uint16_t currentAlertPinMode = currentConfReg & 3;
     
-    setMeasureMode(ADS1115_SINGLE);
-    
-    switch(range){
-        case ADS1115_RANGE_6144:
-            voltageRange = 6144;
-            break;
-        case ADS1115_RANGE_4096:
-            voltageRange = 4096;
-            break;
-        case ADS1115_RANGE_2048:
-            voltageRange = 2048;
-            break;
-        case ADS1115_RANGE_1024:
-            voltageRange = 1024;
-            break;
-        case ADS1115_RANGE_0512:
-            voltageRange = 512;
-            break;
-        case ADS1115_RANGE_0256:
-            voltageRange = 256;
-            break;
-    }
-    
-    if ((currentRange != range) && (currentAlertPinMode != ADS1115_DISABLE_ALERT)){
-        int16_t alertLimit = readRegister(ADS1115_HI_THRESH_REG);
-        alertLimit = alertLimit * (currentVoltageRange * 1.0 / voltageRange);
-        writeRegister(ADS1115_HI_THRESH_REG, alertLimit);
-        
-        alertLimit = readRegister(ADS1115_LO_THRESH_REG);
-        alertLimit = alertLimit * (currentVoltageRange * 1.0 / voltageRange);
-        writeRegister(ADS1115_LO_THRESH_REG, alertLimit);
+    if(currentRange == range){
+        /* no register writes, but the wait for a new result is kept in continuous mode (callers 
+           rely on it, e.g. after a channel change) */
+        if(currentMeasureMode == ADS1115_CONTINUOUS){
+            waitForNewResults(1);
+            rangeSettling = false;
+        }
+        return;
+    }
+    
+    /* stop continuous conversions while the range is changed */
+    if((currentMeasureMode == ADS1115_CONTINUOUS) && !configTransaction){
+        writeRegister(ADS1115_CONFIG_REG, currentConfReg | ADS1115_SINGLE);
+    }
+    
+    voltageRange = rangeToMillivolts(range);
+    
+    if (currentAlertPinMode != ADS1115_DISABLE_ALERT){
+        rescaleLimits(currentVoltageRange);
     }
     
     currentConfReg &= ~(0x8E00);    
     currentConfReg |= range;
-    writeRegister(ADS1115_CONFIG_REG, currentConfReg);
-    setMeasureMode(currentMeasureMode);
+    writeConfReg(currentConfReg); // restores the measure mode, too
     if (currentMeasureMode == ADS1115_CONTINUOUS){
-        convRate rate = getConvRate();
-        delayAccToRate(rate);
+        waitForNewResults(1);
+    }
+    rangeSettling = false;
+}
+
+void ADS1115_WE::setVoltageRange_mV_nonblock(ADS1115_RANGE range){
+    uint16_t currentVoltageRange = voltageRange;
+    uint16_t currentConfReg = confRegShadow;
+    uint16_t currentAlertPinMode = currentConfReg & 3;
+    
+    if(getRange() == range){
+        return;
+    }
+    voltageRange = rangeToMillivolts(range);
+    
+    if (currentAlertPinMode != ADS1115_DISABLE_ALERT){
+        rescaleLimits(currentVoltageRange);
+    }
+    
+    currentConfReg &= ~(0x0E00);    
+    currentConfReg |= range;
+    writeConfReg(currentConfReg);
+    
+    /* continuous mode: the conversion in progress is completed in the old range, the next 
+       one in the new range. Oscillator tolerance: +10% */
+    if(!(currentConfReg & 0x0100)){
+        rangeSettling = true;
+        rangeSwitchTime = micros();
+        rangeSettleTime = 2 * maxConvTime_us(getConvRate());
     }
 }
 
@@ -171,21 +261,21 @@ uint16_t ADS1115_WE::getVoltageRange_mV(){
 }
 
 ADS1115_RANGE ADS1115_WE::getRange(){
-    uint16_t currentConfReg = readRegister(ADS1115_CONFIG_REG);
+    uint16_t currentConfReg = confRegShadow;
     ADS1115_RANGE currentRange = (ADS1115_RANGE)(currentConfReg & 0x0E00);
     return currentRange;
 }
 
+#ifndef ADS1115_NO_AUTO_RANGE
 void ADS1115_WE::setAutoRange(){
     setVoltageRange_mV(ADS1115_RANGE_6144);
     ADS1115_MEASURE_MODE currentMeasureMode = getMeasureMode();
     if(currentMeasureMode == ADS1115_SINGLE){
         startSingleMeasurement();
-        while(isBusy()){delay(0);}
+        busyWait();
     }
     else{ // in continuous mode you need to wait for a new result
-        convRate rate = getConvRate();
-        delayAccToRate(rate);
+        waitForConversion();
     }
     
     int16_t rawResult = readRegister(ADS1115_CONV_REG);
@@ -218,7 +308,7 @@ void ADS1115_WE::setAutoRange(){
        this is managed in setVoltageRange() */
     if(currentMeasureMode == ADS1115_SINGLE){
         startSingleMeasurement();
-        while(isBusy()){delay(0);}
+        busyWait();
     } 
 }
 
@@ -231,104 +321,76 @@ void ADS1115_WE::setPermanentAutoRangeMode(bool autoMode){
     }
 }
 
+void ADS1115_WE::setPredictiveAutoRange(bool predictive){
+    predictiveAutoRange = predictive;
+}
+
+void ADS1115_WE::setAutoRangeThresholds(uint8_t lowerPercent, uint8_t upperPercent){
+    if((lowerPercent >= upperPercent) || (upperPercent > 100)){
+        return;
+    }
+    autoRangeLower = static_cast<int32_t>(lowerPercent) * 32767 / 100;
+    autoRangeUpper = static_cast<int32_t>(upperPercent) * 32767 / 100;
+}
+#endif
+
+#ifndef ADS1115_NO_CHANNEL_RANGES
 void ADS1115_WE::setRememberChannelRanges(bool rcr) {
     if(rcr){
         rememberChannelRanges = true;
     }
     else rememberChannelRanges = false;
 }
+#endif
 
+/* Nominal conversion time + 10% (or the calibrated one), from the same table as the other 
+   waiting times */
 void ADS1115_WE::delayAccToRate(convRate cr){
-    if(!useADS1015){
-        switch(cr){
-            case ADS1115_8_SPS:
-                delay(130);
-                break;
-            case ADS1115_16_SPS:
-                delay(65);
-                break;
-            case ADS1115_32_SPS:
-                delay(32);
-                break;
-            case ADS1115_64_SPS:
-                delay(16);
-                break;
-            case ADS1115_128_SPS:
-                delay(8);
-                break;
-            case ADS1115_250_SPS:
-                delay(4);
-                break;
-            case ADS1115_475_SPS:
-                delay(3);
-                break;
-            case ADS1115_860_SPS:
-                delay(2);
-                break;
-        }
-    }
-    else{
-        switch(cr){
-            case ADS1015_128_SPS:
-                delay(8);
-                break;
-            case ADS1015_250_SPS:
-                delay(5);
-                break;
-            case ADS1015_490_SPS:
-                delay(2);
-                break;
-            case ADS1015_920_SPS:
-                delay(1);
-                break;
-            case ADS1015_1600_SPS:
-                delayMicroseconds(675);
-                break;
-            case ADS1015_2400_SPS:
-                delayMicroseconds(450);
-                break;
-            case ADS1015_3300_SPS:
-                delayMicroseconds(330);
-                break;
-            case ADS1015_3300_SPS_2:
-                delayMicroseconds(330);
-                break;
-        }
-    }
+#ifdef ADS1115_ENABLE_STATS
+    unsigned long startTime = micros();
+#endif
+    delayMicros(maxConvTime_us(cr));
+#ifdef ADS1115_ENABLE_STATS
+    stats.delayTime_us += micros() - startTime;
+#endif
 }   
     
 void ADS1115_WE::setCompareChannels(ADS1115_MUX mux){
-    uint16_t currentConfReg = readRegister(ADS1115_CONFIG_REG);
-    /* Saving the range of the channel before change of channel */
+    uint16_t currentConfReg = confRegShadow;
+#ifndef ADS1115_NO_CHANNEL_RANGES
+    /* Saving the range of the channel before change of channel (range code as nibble) */
     uint8_t currentChannel = (currentConfReg >> 12) & 0x7; // corresponding bits in config reg
     uint8_t currentRange = (currentConfReg >> 9) & 0x7; // corresponding bits in config reg
-    channelRange[currentChannel] = currentRange;
+    uint8_t shift = (currentChannel & 1) ? 4 : 0;
+    channelRanges[currentChannel >> 1] &= ~(0x0F << shift);
+    channelRanges[currentChannel >> 1] |= currentRange << shift;
+#endif
     
     currentConfReg &= ~(0xF000);    
     currentConfReg |= (mux);
     
-    writeRegister(ADS1115_CONFIG_REG, currentConfReg);
+    writeConfReg(currentConfReg);
     
+#ifndef ADS1115_NO_CHANNEL_RANGES
     /* Applying the range to the channel that was used lst time */
     if(rememberChannelRanges){
         uint8_t newChannel = mux >> 12;
-        ADS1115_RANGE range = static_cast<ADS1115_RANGE>(channelRange[newChannel] << 9);
+        uint8_t rangeCode = (channelRanges[newChannel >> 1] >> ((newChannel & 1) ? 4 : 0)) & 0x0F;
+        ADS1115_RANGE range = static_cast<ADS1115_RANGE>(rangeCode << 9);
         setVoltageRange_mV(range);
     }   
+#endif
        
     if(!(currentConfReg & 0x0100)){  // => if not single shot mode you need to wait for a new result
-        convRate rate = getConvRate();      
-        for(int i=0; i<2; i++){ // waiting time for two measurements
-            delayAccToRate(rate);
-        }                 
+        waitForNewResults(2); // waiting time for two measurements
     }       
 }
 
 void ADS1115_WE::setCompareChannels_nonblock(ADS1115_MUX mux){
-    uint16_t currentConfReg = readRegister(ADS1115_CONFIG_REG);
+    uint16_t currentConfReg = confRegShadow;
     currentConfReg &= ~(0xF000);    
     currentConfReg |= (mux);
-    writeRegister(ADS1115_CONFIG_REG, currentConfReg);
+    writeConfReg(currentConfReg);
 }
 
 void ADS1115_WE::setSingleChannel(size_t channel) {
@@ -337,22 +399,81 @@ void ADS1115_WE::setSingleChannel(size_t channel) {
     setCompareChannels((ADS1115_MUX)(ADS1115_COMP_0_GND + ADS1115_COMP_INC*channel));
 }
 
+void ADS1115_WE::setScanEntry(const ADS1115_ScanEntry &entry){
+    setScanEntry_nonblock(entry);
+    if(rangeSettling){
+        /* the conversion in progress can have a different rate than the new entry */
+        if(configTransaction || useReadySignal()){
+            waitForNewResults(2);
+        }
+        else{
+            delayMicros(rangeSettleTime);
+        }
+        rangeSettling = false;
+    }
+}
+
+void ADS1115_WE::setScanEntry_nonblock(const ADS1115_ScanEntry &entry){
+    uint32_t oldMaxConvTime = maxConvTime_us(getConvRate());
+    uint16_t currentConfReg = confRegShadow;
+    currentConfReg &= ~(ADS1115_ScanEntry::CONFIG_MASK);
+    currentConfReg |= entry.config;
+    voltageRange = rangeToMillivolts(entry.range());
+    writeConfReg(currentConfReg);
+    
+    /* continuous mode: the conversion in progress is completed with the old entry */
+    if(!(currentConfReg & 0x0100)){
+        rangeSettling = true;
+        rangeSwitchTime = micros();
+        rangeSettleTime = oldMaxConvTime + maxConvTime_us(entry.rate());
+    }
+}
+
 bool ADS1115_WE::isBusy(){
-    uint16_t currentConfReg = readRegister(ADS1115_CONFIG_REG);
-    if(currentConfReg & 0x0100) { // if single shot mode
+    if(confRegShadow & 0x0100) { // if single shot mode
+        uint16_t currentConfReg = readRegister(ADS1115_CONFIG_REG); // OS bit is only available from the device
         return (!(currentConfReg>>15) & 1);
     }
     else return 0;
 }
+
+bool ADS1115_WE::isConvDue(){
+    convRate rate = static_cast<convRate>(convConfig & 0x00E0);
+    return (micros() - convStartTime) >= minConvTime_us(rate);
+}
+
+bool ADS1115_WE::isConvOverdue(){
+    convRate rate = static_cast<convRate>(convConfig & 0x00E0);
+    return (micros() - convStartTime) > 3 * maxConvTime_us(rate);
+}
     
 
 void ADS1115_WE::startSingleMeasurement(){
-    uint16_t currentConfReg = readRegister(ADS1115_CONFIG_REG);
+    uint16_t currentConfReg = confRegShadow;
     currentConfReg |= (1 << 15);
     writeRegister(ADS1115_CONFIG_REG, currentConfReg);
+    pendingRegs &= ~(1 << ADS1115_CONFIG_REG); // pending config changes were written, too
+}
+
+void ADS1115_WE::startSingleMeasurement(ADS1115_MUX mux){
+    uint16_t currentConfReg = confRegShadow;
+    currentConfReg &= ~(0xF000);
+    currentConfReg |= mux | (1 << 15);
+    writeRegister(ADS1115_CONFIG_REG, currentConfReg);
+    pendingRegs &= ~(1 << ADS1115_CONFIG_REG);
+}
+
+void ADS1115_WE::startSingleMeasurement(const ADS1115_ScanEntry &entry){
+    uint16_t currentConfReg = confRegShadow;
+    currentConfReg &= ~(0x8000 | ADS1115_ScanEntry::CONFIG_MASK);
+    currentConfReg |= entry.config | (1 << 15);
+    voltageRange = rangeToMillivolts(entry.range());
+    writeRegister(ADS1115_CONFIG_REG, currentConfReg);
+    pendingRegs &= ~(1 << ADS1115_CONFIG_REG);
 }
 
     
+#ifndef ADS1115_NO_FLOAT
 float ADS1115_WE::getResult_V(){
     float result = getResult_mV();
     result /= 1000;
@@ -360,13 +481,23 @@ float ADS1115_WE::getResult_V(){
 }
 
 float ADS1115_WE::getResult_mV(){
-    int16_t rawResult = getRawResult();
-    float result = (rawResult * 1.0 / ADS1115_REG_FACTOR) * voltageRange;
-    return result;
+    return getResult_mV_fixed() / 65536.0;
+}
+#endif
+
+/* One LSB is (voltageRange / 256) * 7.8125 µV */
+int32_t ADS1115_WE::getResult_uV(){
+    return rawToMicrovolts(getRawResult(), voltageRange >> 8);
+}
+
+/* mV = raw * voltageRange / 32768, in Q16.16: raw * voltageRange * 2 (exact, no rounding) */
+int32_t ADS1115_WE::getResult_mV_fixed(){
+    return rawToMillivoltsFixed(getRawResult(), voltageRange);
 }
 
 int16_t ADS1115_WE::getRawResult(){
     int16_t rawResult = readRegister(ADS1115_CONV_REG);
+#ifndef ADS1115_NO_AUTO_RANGE
     if(autoRangeMode){
         int16_t rawResultCopy = rawResult;
         if(rawResultCopy == -32768){
@@ -382,77 +513,840 @@ int16_t ADS1115_WE::getRawResult(){
             rawResult = readRegister(ADS1115_CONV_REG);
         }
     }
+#endif
+    updateStatistics(rawResult, resultConfig());
     return rawResult;
 }
 
+int16_t ADS1115_WE::getRawResultInISR(){
+    int16_t rawResult = readRegisterUnlocked(ADS1115_CONV_REG);
+    updateStatistics(rawResult, resultConfig());
+    return rawResult;
+}
+
+bool ADS1115_WE::getSample(ADS1115_Sample &sample){
+    bool continuous = !(confRegShadow & 0x0100);
+    if(continuous && rangeSettling){
+        if((micros() - rangeSwitchTime) < rangeSettleTime){
+            return false;
+        }
+        rangeSettling = false;
+    }
+    uint16_t conf = resultConfig();
+    sample.raw = readRegister(ADS1115_CONV_REG);
+    sample.range = static_cast<ADS1115_RANGE>(conf & 0x0E00);
+    updateStatistics(sample.raw, conf);
+    
+#ifndef ADS1115_NO_AUTO_RANGE
+    /* only results of the current range say something about the current range */
+    if(predictiveAutoRange && (sample.range == getRange())){
+        ADS1115_RANGE newRange = predictRange(sample.raw, sample.range);
+        if(newRange != sample.range){
+            setVoltageRange_mV_nonblock(newRange);
+        }
+    }
+#endif
+    return true;
+}
+
+#ifndef ADS1115_NO_STATISTICS
+void ADS1115_WE::attachStatistics(ADS1115_Statistics &stats, ADS1115_MUX mux){
+    channelStats[(mux >> 12) & 7] = &stats;
+}
+
+void ADS1115_WE::detachStatistics(ADS1115_MUX mux){
+    channelStats[(mux >> 12) & 7] = nullptr;
+}
+#endif
+
+size_t ADS1115_WE::readBlock(int16_t *buf, size_t n, uint32_t *timestamps){
+    uint16_t savedConfReg = confRegShadow;
+    uint16_t savedLoThresh = loThreshShadow;
+    uint16_t savedHiThresh = hiThreshShadow;
+    size_t count = 0;
+    blockMissed = 0;
+    
+    if(readyPin >= 0){
+        count = readBlockReadyPin(buf, n, timestamps);
+    }
+    else{
+        count = readBlockSingleShot(buf, n, timestamps);
+    }
+    
+    /* only changed registers are written */
+    beginConfig();
+    writeThreshReg(ADS1115_LO_THRESH_REG, savedLoThresh);
+    writeThreshReg(ADS1115_HI_THRESH_REG, savedHiThresh);
+    writeConfReg(savedConfReg);
+    commitConfig();
+    return count;
+}
+
+uint16_t ADS1115_WE::getMissedConversions(){
+    return blockMissed;
+}
+
+void ADS1115_WE::setReadyPin(int8_t pin){
+    readyPin = pin;
+}
+
+int8_t ADS1115_WE::getReadyPin(){
+    return readyPin;
+}
+
+bool ADS1115_WE::isReadyPinActive(){
+    if(readyPin < 0){
+        return false;
+    }
+    uint8_t activeLevel = (confRegShadow & ADS1115_ACT_HIGH) ? HIGH : LOW;
+    return digitalRead(readyPin) == activeLevel;
+}
+
+uint8_t ADS1115_WE::getReadyEvents(){
+#ifndef ADS1115_NO_WAIT_STRATEGY
+    return readyEvents;
+#else
+    return 0;
+#endif
+}
+
+void ADS1115_WE::clearReadyEvents(){
+#ifndef ADS1115_NO_WAIT_STRATEGY
+    readyEvents = 0;
+#endif
+}
+
+bool ADS1115_WE::waitForReadySignal(uint32_t maxTime_us){
+#ifndef ADS1115_NO_WAIT_STRATEGY
+    if(convWaitStrategy == ADS1115_WAIT_INTERRUPT){
+        return waitForReadyEvents(1, micros(), maxTime_us);
+    }
+#endif
+    if(readyPin >= 0){
+        return waitForReadyPin(micros(), maxTime_us);
+    }
+    delayMicros(maxTime_us);
+    return false;
+}
+
+#ifndef ADS1115_NO_BUS_LOCK
+void ADS1115_WE::setBusLock(ADS1115_LockFunction lock, ADS1115_LockFunction unlock, void *arg){
+    busLock = lock;
+    busUnlock = unlock;
+    busLockArg = arg;
+}
+#endif
+
+#ifndef ADS1115_NO_CALIBRATION
+bool ADS1115_WE::calibrateConvRate(uint8_t conversions){
+    conversions = constrain(conversions, 2, 16);
+    uint32_t nominal = nominalConvTime_us(getConvRate());
+    uint32_t timeout = 3 * maxConvTime_us(getConvRate());
+    uint32_t measured = 0;
+    
+    if(readyPin >= 0){ // time between the conversion ready edges in continuous mode
+        int16_t results[17];
+        uint32_t timestamps[17];
+        size_t count = readBlock(results, conversions + 1, timestamps);
+        if(count < 2){
+            return false;
+        }
+        measured = (timestamps[count - 1] - timestamps[0]) / (count - 1 + blockMissed);
+    }
+    else{ // start of single shot conversions until the OS bit is set
+        uint16_t savedConfReg = confRegShadow;
+        if(!(confRegShadow & ADS1115_SINGLE)){
+            writeConfReg(confRegShadow | ADS1115_SINGLE);
+        }
+        /* No polling before the conversion can be completed (oscillator -10% and some reserve). 
+           The conversion ended between the last poll which found it busy and the end of the 
+           first poll which found it ready, the middle of this window is taken. Without this, 
+           the poll time (a complete register read) would be part of the result. The window 
+           is the resolution, it must be small compared to the reserve of the waits (~3%). */
+        uint32_t earliest = nominal - nominal / 8;
+        uint32_t total = 0;
+        uint32_t maxWindow = 0;
+        bool tooFast = false; // completed before the first poll: more than 12.5% too fast
+        /* the first conversion is not timed: a conversion of the continuous mode might still run */
+        for(uint8_t i=0; i<=conversions; i++){
+            startSingleMeasurement();
+            unsigned long startTime = convStartTime;
+            delayMicros(earliest);
+            unsigned long lastBusy = micros() - startTime; 
+            bool polledBusy = false;
+            while(isBusy()){
+                polledBusy = true;
+                lastBusy = micros() - startTime;
+                if(lastBusy > timeout){
+                    writeConfReg(savedConfReg);
+                    return false;
+                }
+            }
+            uint32_t ready = micros() - startTime;
+            if(i > 0){
+                tooFast = tooFast || !polledBusy;
+                total += (lastBusy + ready) / 2;
+                maxWindow = (ready - lastBusy > maxWindow) ? ready - lastBusy : maxWindow;
+            }
+        }
+        if(savedConfReg != confRegShadow){
+            writeConfReg(savedConfReg);
+        }
+        if(tooFast || (maxWindow > nominal / 32)){ // or rate too high for the bus clock
+            return false;
+        }
+        measured = total / conversions;
+    }
+    /* the datasheet specifies +/-10%, everything far outside is a measurement error */
+    uint32_t factor = (measured << 12) / nominal;
+    if((factor < 3482) || (factor > 4710)){ // 0.85 ... 1.15
+        return false;
+    }
+    convTimeFactor = factor;
+    return true;
+}
+
+void ADS1115_WE::resetConvRateCalibration(){
+    convTimeFactor = 0;
+}
+#endif
+
+#ifndef ADS1115_NO_WAIT_STRATEGY
+void ADS1115_WE::setWaitStrategy(ADS1115_WAIT_STRATEGY strategy){
+    convWaitStrategy = strategy;
+}
+#endif
+
+ADS1115_WAIT_STRATEGY ADS1115_WE::getWaitStrategy(){
+    return convWaitStrategy;
+}
+
+#ifndef ADS1115_NO_WAIT_STRATEGY
+void ADS1115_WE::setPollBackoff(uint16_t firstInterval_us, uint16_t maxInterval_us){
+    pollFirstInterval = firstInterval_us;
+    pollMaxInterval = (maxInterval_us > firstInterval_us) ? maxInterval_us : firstInterval_us;
+}
+#endif
+
+bool ADS1115_WE::waitForConversion(){
+    if(confRegShadow & ADS1115_SINGLE){
+        return busyWait();
+    }
+    if(useReadySignal()){
+        return waitForReadyEdges(1);
+    }
+    delayAccToRate(getConvRate());
+    return true;
+}
+
+#ifndef ADS1115_NO_WAIT_STRATEGY
+void ADS1115_WE::notifyConversionReady(){
+    if(readyEvents < 255){
+        readyEvents++;
+    }
+}
+#endif
+
+uint32_t ADS1115_WE::getConvTime_us(){
+    uint32_t nominal = nominalConvTime_us(getConvRate());
+    if(convTimeFactor){
+        return (nominal * convTimeFactor) >> 12;
+    }
+    return nominal;
+}
+
+uint32_t ADS1115_WE::getMaxConvTime_us(){
+    return maxConvTime_us(getConvRate());
+}
+
 int16_t ADS1115_WE::getResultWithRange(int16_t min, int16_t max){
-    int16_t rawResult = getRawResult();
-    int16_t result = map(rawResult, -32768, 32767, min, max);
-    return result;
+    return rawToRange(getRawResult(), min, max);
 }
 
 int16_t ADS1115_WE::getResultWithRange(int16_t min, int16_t max, int16_t maxMillivolt){
-    int16_t result = getResultWithRange(min, max);
-    result = static_cast<int16_t>((1.0 * result * voltageRange / maxMillivolt) + 0.5);
-    return result;
+    return rangeToMillivoltScale(getResultWithRange(min, max), voltageRange, maxMillivolt);
 }
 
 void ADS1115_WE::setAlertPinToConversionReady(){
-    writeRegister(ADS1115_LO_THRESH_REG, (0<<15));
-    writeRegister(ADS1115_HI_THRESH_REG, (1<<15));
+    writeThreshReg(ADS1115_LO_THRESH_REG, (0<<15));
+    writeThreshReg(ADS1115_HI_THRESH_REG, (1<<15));
+}
+
+int16_t ADS1115_WE::clearAlert(){
+    return readRegister(ADS1115_CONV_REG);
+}
+
+#ifndef ADS1115_NO_HS_MODE
+bool ADS1115_WE::beginHsSession(uint32_t hsClock, uint32_t fsClock, uint8_t masterCode){
+#ifndef USE_TINY_WIRE_M_
+    endHsSession();
+    if((masterCode & 0xF9) != 0x08){ // 0000 1xx0, the last bit is sent as write bit
+        return false;
+    }
+    lockBus();
+    hsFsClock = fsClock;
+    _wire->setClock(fsClock);
+    _wire->beginTransmission(masterCode >> 1);
+    _wire->endTransmission(false); // the master code is not acknowledged, no STOP
+    _wire->setClock(hsClock);
+    hsSession = true;
+    
+    /* the ADS1115 only answers if the Hs-mode has been entered */
+    uint16_t currentConfReg = readRegister(ADS1115_CONFIG_REG) & ~(0x8000);
+    if((pointerReg == ADS1115_NO_REG) || (currentConfReg != confRegShadow)){
+        endHsSession();
+        return false;
+    }
+    return true; // the bus lock is held until endHsSession()
+#else
+    (void)hsClock;
+    (void)fsClock;
+    (void)masterCode;
+    return false;
+#endif
+}
+
+void ADS1115_WE::endHsSession(){
+#ifndef USE_TINY_WIRE_M_
+    if(!hsSession){
+        return;
+    }
+    lockBus();
+    hsSession = false;
+    _wire->setClock(hsFsClock);
+    _wire->beginTransmission(i2cAddress); // address only, the STOP ends the Hs-mode
+    _wire->endTransmission();
+    unlockBus();
+    unlockBus(); // taken by beginHsSession()
+#endif
+}
+
+bool ADS1115_WE::isHsSession(){
+    return hsSession;
 }
+#endif
 
-void ADS1115_WE::clearAlert(){
-    readRegister(ADS1115_CONV_REG);
+void ADS1115_WE::beginConfig(){
+    configTransaction = true;
 }
 
+void ADS1115_WE::commitConfig(){
+    configTransaction = false;
+    lockBus();
+    uint8_t err = 0;
+    /* thresholds first, so that the comparator never works with a new range and old limits */
+    if(pendingRegs & (1 << ADS1115_LO_THRESH_REG)){
+        err |= writeRegister(ADS1115_LO_THRESH_REG, loThreshShadow);
+    }
+    if(pendingRegs & (1 << ADS1115_HI_THRESH_REG)){
+        err |= writeRegister(ADS1115_HI_THRESH_REG, hiThreshShadow);
+    }
+    if(pendingRegs & (1 << ADS1115_CONFIG_REG)){
+        err |= writeRegister(ADS1115_CONFIG_REG, confRegShadow);
+    }
+    pendingRegs = 0;
+    /* the copies were changed before the writes, a failed write leaves them out of sync */
+    if(err){
+        resyncFromDevice();
+    }
+    unlockBus();
+    
+    uint8_t waits = pendingConvWaits;
+    pendingConvWaits = 0;
+    if(getMeasureMode() == ADS1115_CONTINUOUS){
+        waitForNewResults(waits);
+    }
+}
+
+#ifdef ADS1115_ENABLE_STATS
+/* The counters are updated inside the bus lock, so they are read and reset inside it, too */
+ADS1115_Stats ADS1115_WE::getStats(){
+    lockBus();
+    ADS1115_Stats snapshot = stats;
+    unlockBus();
+    return snapshot;
+}
+
+void ADS1115_WE::resetStats(){
+    lockBus();
+    stats = ADS1115_Stats();
+    unlockBus();
+}
+#endif
+
 /************************************************ 
     private functions
 *************************************************/
 
+/* Single shot mode: waits for the conversion started last */
+bool ADS1115_WE::busyWait(){
+#ifdef ADS1115_ENABLE_STATS
+    unsigned long startTime = micros();
+#endif
+    convRate rate = static_cast<convRate>(convConfig & 0x00E0);
+    uint32_t maxTime = maxConvTime_us(rate);
+    bool ready = true;
+    if(useReadySignal()){
+#ifndef ADS1115_NO_WAIT_STRATEGY
+        if(convWaitStrategy == ADS1115_WAIT_INTERRUPT){
+            ready = waitForReadyEvents(1, convStartTime, maxTime);
+        }
+        else
+#endif
+        { // the pin stays active until the next conversion is started
+            ready = waitForReadyPin(convStartTime, maxTime);
+        }
+    }
+    else if(convWaitStrategy == ADS1115_WAIT_TIMED){
+        unsigned long elapsed = micros() - convStartTime;
+        if(elapsed < maxTime){
+            delayMicros(maxTime - elapsed);
+        }
+    }
+    else{
+        ready = pollOsBit(rate);
+    }
+#ifdef ADS1115_ENABLE_STATS
+    stats.busyWaitTime_us += micros() - startTime;
+#endif
+    return ready;
+}
+
+/* Conversion ready signal usable: pin or interrupt strategy and the alert pin configured as 
+   conversion ready pin (comparator enabled, MSB of the high threshold 1, of the low threshold 0) */
+bool ADS1115_WE::useReadySignal(){
+    if(!((convWaitStrategy == ADS1115_WAIT_INTERRUPT) 
+            || ((convWaitStrategy == ADS1115_WAIT_POLL_RDY_PIN) && (readyPin >= 0)))){
+        return false;
+    }
+    return ((confRegShadow & 0x0003) != ADS1115_DISABLE_ALERT) 
+            && (hiThreshShadow & 0x8000) && !(loThreshShadow & 0x8000);
+}
+
+/* No I2C traffic before the conversion can be completed (isConvDue()), then polls with backoff. 
+   Without setPollBackoff() the interval is 1/8 of the tolerance window (max - min conversion 
+   time), so a conversion is found with about 8 reads at most, and later calibration narrows it. */
+bool ADS1115_WE::pollOsBit(convRate rate){
+    unsigned long elapsed = micros() - convStartTime;
+    uint32_t minTime = minConvTime_us(rate);
+    uint32_t maxTime = maxConvTime_us(rate);
+    uint16_t interval = pollFirstInterval;
+    uint16_t maxInterval = pollMaxInterval;
+    if(!interval){
+        interval = maxInterval = (maxTime - minTime) / 8 + 1;
+    }
+    if(elapsed < minTime){
+        delayMicros(minTime - elapsed);
+    }
+    while(isBusy()){
+        if((micros() - convStartTime) > 3 * maxTime){
+            return false;
+        }
+        delayMicros(interval);
+        interval = (interval < maxInterval / 2) ? interval * 2 : maxInterval;
+    }
+    return true;
+}
+
+bool ADS1115_WE::waitForReadyPin(unsigned long startTime, uint32_t maxTime){
+    uint8_t activeLevel = (confRegShadow & ADS1115_ACT_HIGH) ? HIGH : LOW;
+    while(digitalRead(readyPin) != activeLevel){
+        if((micros() - startTime) > maxTime){
+            return false;
+        }
+    }
+    return true;
+}
+
+#ifndef ADS1115_NO_WAIT_STRATEGY
+bool ADS1115_WE::waitForReadyEvents(uint8_t events, unsigned long startTime, uint32_t maxTime){
+#ifdef __AVR__
+    set_sleep_mode(SLEEP_MODE_IDLE); // timer 0 keeps running, micros() works
+#endif
+    while(readyEvents < events){
+        if((micros() - startTime) > maxTime){
+            return false;
+        }
+#ifdef __AVR__
+        /* sleep_cpu() is executed before a pending interrupt, so no wake-up gets lost */
+        noInterrupts();
+        if(readyEvents < events){
+            sleep_enable();
+            interrupts();
+            sleep_cpu();
+            sleep_disable();
+        }
+        interrupts();
+#else
+        yield();
+#endif
+    }
+    return true;
+}
+#endif
+
+/* Continuous mode: waits for the next edges of the conversion ready signal */
+bool ADS1115_WE::waitForReadyEdges(uint8_t edges){
+#ifdef ADS1115_ENABLE_STATS
+    unsigned long startTime = micros();
+#endif
+    uint32_t maxTime = maxConvTime_us(getConvRate());
+    uint8_t activeLevel = (confRegShadow & ADS1115_ACT_HIGH) ? HIGH : LOW;
+    bool ready = true;
+    clearReadyEvents();
+    for(uint8_t i=0; i<edges; i++){
+        unsigned long edgeStart = micros();
+#ifndef ADS1115_NO_WAIT_STRATEGY
+        if(convWaitStrategy == ADS1115_WAIT_INTERRUPT){
+            ready = waitForReadyEvents(i + 1, edgeStart, maxTime) && ready;
+        }
+        else
+#endif
+        {
+            /* the pulse is only ~8 µs, but make sure not to see it twice */
+            while((digitalRead(readyPin) == activeLevel) && ((micros() - edgeStart) < maxTime / 2)){}
+            ready = waitForReadyPin(edgeStart, maxTime) && ready;
+        }
+    }
+#ifdef ADS1115_ENABLE_STATS
+    stats.delayTime_us += micros() - startTime;
+#endif
+    return ready;
+}
+
+#ifdef ADS1115_ENABLE_STATS
+void ADS1115_WE::recordTransaction(uint8_t bytes, uint8_t err, unsigned long duration){
+    stats.transactions++;
+    stats.bytes += bytes;
+    stats.busTime_us += duration;
+    if(err){
+        stats.endTransmissionErrors[(err < 5) ? err : 5]++;
+    }
+}
+#endif
+
+#ifndef ADS1115_NO_AUTO_RANGE
+ADS1115_RANGE ADS1115_WE::predictRange(int16_t raw, ADS1115_RANGE measRange){
+    int16_t fullScale = fullScaleRaw(getChip());
+    if((raw >= fullScale) || (raw == -32768)){
+        return ADS1115_RANGE_6144;  // saturated, the real value is unknown
+    }
+    int16_t magnitude = abs(raw);
+    if((magnitude >= autoRangeLower) && (magnitude <= autoRangeUpper)){
+        return measRange;
+    }
+    /* magnitude in LSBs of the 256 mV range, then the smallest range below the upper threshold */
+    uint32_t absValue = static_cast<uint32_t>(magnitude) * rangeFactor(measRange);
+    for(uint8_t i=5; i>0; i--){
+        ADS1115_RANGE candidate = static_cast<ADS1115_RANGE>(i << 9);
+        if(absValue <= static_cast<uint32_t>(autoRangeUpper) * rangeFactor(candidate)){
+            return candidate;
+        }
+    }
+    return ADS1115_RANGE_6144;
+}
+#endif
+
+/* Config the result in the conversion register was measured with: in single shot mode the 
+   config that started the conversion, in continuous mode the current one */
+uint16_t ADS1115_WE::resultConfig(){
+    return (confRegShadow & 0x0100) ? convConfig : confRegShadow;
+}
+
+void ADS1115_WE::updateStatistics(int16_t raw, uint16_t conf){
+#ifndef ADS1115_NO_STATISTICS
+    ADS1115_Statistics *stats = channelStats[(conf >> 12) & 7];
+    if(stats){
+        stats->add(raw, static_cast<ADS1115_RANGE>(conf & 0x0E00));
+    }
+#else
+    (void)raw;
+    (void)conf;
+#endif
+}
+
+size_t ADS1115_WE::readBlockReadyPin(int16_t *buf, size_t n, uint32_t *timestamps){
+    uint32_t convTime = getConvTime_us();
+    uint32_t timeout = 3 * maxConvTime_us(getConvRate());
+    
+    /* conversion ready, continuous mode */
+    beginConfig();
+    writeThreshReg(ADS1115_LO_THRESH_REG, 0x0000);
+    writeThreshReg(ADS1115_HI_THRESH_REG, 0x8000);
+    writeConfReg((confRegShadow & ~(0x0103)) | ADS1115_CONTINUOUS | ADS1115_ASSERT_AFTER_1);
+    commitConfig();
+    uint8_t activeLevel = (confRegShadow & ADS1115_ACT_HIGH) ? HIGH : LOW;
+    
+    unsigned long lastReady = 0;
+    for(size_t i=0; i<n; i++){
+        unsigned long waitStart = micros();
+        while(digitalRead(readyPin) != activeLevel){
+            if((micros() - waitStart) > timeout){
+                return i;
+            }
+        }
+        unsigned long readyTime = micros();
+        buf[i] = readRegister(ADS1115_CONV_REG);
+        if(timestamps){
+            timestamps[i] = readyTime;
+        }
+        /* more than one conversion period since the last one -> missed conversions */
+        if(i > 0){
+            uint32_t periods = (readyTime - lastReady + convTime / 2) / convTime;
+            if(periods > 1){
+                blockMissed += periods - 1;
+            }
+        }
+        lastReady = readyTime;
+        /* the pulse is only ~8 µs, but make sure not to see it twice */
+        while((digitalRead(readyPin) == activeLevel) && ((micros() - readyTime) < convTime / 2)){}
+    }
+    return n;
+}
+
+size_t ADS1115_WE::readBlockSingleShot(int16_t *buf, size_t n, uint32_t *timestamps){
+    uint32_t convTime = getConvTime_us();
+    /* pipelined: start the next conversion before reading the result. The result stays in the 
+       conversion register until the next conversion is completed, so the read has to take 
+       less than the conversion time (checked with the first read). */
+    bool pipelined = false;
+    
+    if(!(confRegShadow & ADS1115_SINGLE)){
+        writeConfReg(confRegShadow | ADS1115_SINGLE);
+    }
+    startSingleMeasurement();
+    for(size_t i=0; i<n; i++){
+        if(!busyWait()){
+            return i;
+        }
+        unsigned long readyTime = micros();
+        bool more = (i + 1) < n;
+        if(pipelined && more){
+            startSingleMeasurement();
+        }
+        buf[i] = readRegister(ADS1115_CONV_REG);
+        if(timestamps){
+            timestamps[i] = readyTime;
+        }
+        if(!pipelined && more){
+            /* 100% margin for the oscillator tolerance and bus delays */
+            pipelined = 2 * (micros() - readyTime) < convTime;
+            startSingleMeasurement();
+        }
+    }
+    return n;
+}
+
+/* Called by init() and by the constructors of ADS1015_WE and ADS1x15<>. The chip is one bit 
+   of the flags, the constants are taken from ADS1x15_ChipTraits via getChip(). */
+void ADS1115_WE::selectChip(ADS1X15_CHIP chip){
+    useADS1015 = (chip == ADS1015_CHIP);
+}
+
+uint32_t ADS1115_WE::nominalConvTime_us(convRate cr){
+    return convTime_us(getChip(), cr);
+}
+
+/* Upper limit of the conversion time: measured + ~3% + 20 µs if calibrated, else nominal + 10% */
+uint32_t ADS1115_WE::maxConvTime_us(convRate cr){
+    uint32_t nominal = nominalConvTime_us(cr);
+    if(convTimeFactor){
+        uint32_t measured = (nominal * convTimeFactor) >> 12;
+        return measured + measured / 32 + 20;
+    }
+    return nominal + nominal / 10;
+}
+
+/* Lower limit of the conversion time: measured - ~3% if calibrated, else nominal - 10% */
+uint32_t ADS1115_WE::minConvTime_us(convRate cr){
+    uint32_t nominal = nominalConvTime_us(cr);
+    if(convTimeFactor){
+        uint32_t measured = (nominal * convTimeFactor) >> 12;
+        return measured - measured / 32;
+    }
+    return nominal - nominal / 10;
+}
+
+/* delayMicroseconds() is only accurate up to 16383 µs on AVR boards */
+void ADS1115_WE::delayMicros(uint32_t us){
+    if(us >= 1000){
+        delay(us / 1000);
+    }
+    delayMicroseconds(us % 1000);
+}
+
+void ADS1115_WE::writeConfReg(uint16_t val){
+    if(configTransaction){
+        val &= ~(0x8000);
+        if(val != confRegShadow){
+            confRegShadow = val;
+            pendingRegs |= (1 << ADS1115_CONFIG_REG);
+        }
+    }
+    else writeRegister(ADS1115_CONFIG_REG, val);
+}
+
+void ADS1115_WE::writeThreshReg(uint8_t reg, uint16_t val){
+    if(configTransaction){
+        uint16_t &shadow = (reg == ADS1115_LO_THRESH_REG) ? loThreshShadow : hiThreshShadow;
+        if(val != shadow){
+            shadow = val;
+            pendingRegs |= (1 << reg);
+        }
+    }
+    else writeRegister(reg, val);
+}
+
+void ADS1115_WE::waitForNewResults(uint8_t conversions){
+    if(configTransaction){
+        if(conversions > pendingConvWaits){
+            pendingConvWaits = conversions;
+        }
+        return;
+    }
+    if(conversions && useReadySignal()){
+        /* the conversion in progress is completed with the old settings */
+        waitForReadyEdges((conversions < 2) ? 2 : conversions);
+        return;
+    }
+    convRate rate = getConvRate();
+    for(uint8_t i=0; i<conversions; i++){
+        delayAccToRate(rate);
+    }
+}
+
+/* Limits in the new range: limit * oldRange / newRange, limited to int16_t */
+void ADS1115_WE::rescaleLimits(uint16_t oldVoltageRange){
+    int32_t limit = static_cast<int32_t>(static_cast<int16_t>(hiThreshShadow)) * oldVoltageRange / voltageRange;
+    writeThreshReg(ADS1115_HI_THRESH_REG, constrain(limit, -32768L, 32767L));
+    limit = static_cast<int32_t>(static_cast<int16_t>(loThreshShadow)) * oldVoltageRange / voltageRange;
+    writeThreshReg(ADS1115_LO_THRESH_REG, constrain(limit, -32768L, 32767L));
+}
+
+#ifndef ADS1115_NO_FLOAT
 int16_t ADS1115_WE::calcLimit(float rawLimit){
     int16_t limit = static_cast<int16_t>((rawLimit * ADS1115_REG_FACTOR / voltageRange)*1000);
     return limit;
 }
+#endif
+
+#ifndef ADS1115_NO_BUS_LOCK
+void ADS1115_WE::lockBus(){
+    if(busLock){
+        busLock(busLockArg);
+    }
+}
+
+void ADS1115_WE::unlockBus(){
+    if(busUnlock){
+        busUnlock(busLockArg);
+    }
+}
+#endif
 
 uint8_t ADS1115_WE::writeRegister(uint8_t reg, uint16_t val){
     uint8_t lVal = val & 255;
     uint8_t hVal = val >> 8;
+    lockBus();
+#ifdef ADS1115_ENABLE_STATS
+    unsigned long startTime = micros();
+#endif
 #ifndef USE_TINY_WIRE_M_  
     _wire->beginTransmission(i2cAddress);
     _wire->write(reg);
     _wire->write(hVal);
     _wire->write(lVal);
-    return _wire->endTransmission();
+    uint8_t err = _wire->endTransmission(!hsSession); // a STOP would end the Hs-mode
 #else
     TinyWireM.beginTransmission(i2cAddress);
     TinyWireM.send(reg);
     TinyWireM.send(hVal);
     TinyWireM.send(lVal);
-    return TinyWireM.endTransmission();
+    uint8_t err = TinyWireM.endTransmission();
 #endif
+    /* the pointer register keeps its value until the next write */
+    pointerReg = err ? ADS1115_NO_REG : reg;
+    /* the copies are only changed if the device has taken the value */
+    if(!err){
+        switch(reg){
+            case ADS1115_CONFIG_REG:
+                confRegShadow = val & ~(0x8000); // OS bit only triggers single conversions
+                if(val & 0x8000){
+                    convStartTime = micros(); // the conversion starts with the end of the write
+                    convConfig = confRegShadow;
+                    clearReadyEvents();
+                }
+                break;
+            case ADS1115_LO_THRESH_REG:
+                loThreshShadow = val;
+                break;
+            case ADS1115_HI_THRESH_REG:
+                hiThreshShadow = val;
+                break;
+        }
+    }
+#ifdef ADS1115_ENABLE_STATS
+    stats.registerWrites[reg & 3]++;
+    recordTransaction(4, err, micros() - startTime);
+#endif
+    unlockBus();
+    return err;
   
 }
   
 uint16_t ADS1115_WE::readRegister(uint8_t reg){
+    lockBus();
+#ifdef ADS1115_ENABLE_STATS
+    unsigned long startTime = micros();
+    if(reg != pointerReg){
+        stats.pointerWrites++;
+        recordTransaction(2, 0, 0);
+    }
+#endif
+    uint16_t regValue = readRegisterUnlocked(reg);
+#ifdef ADS1115_ENABLE_STATS
+    if(pointerReg == ADS1115_NO_REG){
+        stats.readErrors++;
+    }
+    stats.registerReads[reg & 3]++;
+    recordTransaction(3, 0, micros() - startTime);
+#endif
+    unlockBus();
+    return regValue;
+}
+
+/* The transfer of readRegister() without bus lock and counters, also used in interrupts */
+uint16_t ADS1115_WE::readRegisterUnlocked(uint8_t reg){
     uint8_t MSByte = 0, LSByte = 0;
     uint16_t regValue = 0;
 #ifndef USE_TINY_WIRE_M_    
-    _wire->beginTransmission(i2cAddress);
-    _wire->write(reg);
-    _wire->endTransmission(false);
-    _wire->requestFrom(i2cAddress,static_cast<uint8_t>(2));
+    if(reg != pointerReg){
+        _wire->beginTransmission(i2cAddress);
+        _wire->write(reg);
+        _wire->endTransmission(false); // some cores report a (harmless) code here
+        pointerReg = reg;
+    }
+    _wire->requestFrom(i2cAddress, static_cast<uint8_t>(2), static_cast<uint8_t>(!hsSession));
     if(_wire->available()){
         MSByte = _wire->read();
         LSByte = _wire->read();
     }
+    else{
+        pointerReg = ADS1115_NO_REG;
+    }
 #else
-    TinyWireM.beginTransmission(i2cAddress);
-    TinyWireM.send(reg);
-    TinyWireM.endTransmission();
-    TinyWireM.requestFrom(i2cAddress,static_cast<uint8_t>(2));
-    MSByte = TinyWireM.receive();
-    LSByte = TinyWireM.receive();
+    if(reg != pointerReg){
+        TinyWireM.beginTransmission(i2cAddress);
+        TinyWireM.send(reg);
+        pointerReg = TinyWireM.endTransmission() ? ADS1115_NO_REG : reg;
+    }
+    if(TinyWireM.requestFrom(i2cAddress, static_cast<uint8_t>(2)) == 0){ // 0 = success
+        MSByte = TinyWireM.receive();
+        LSByte = TinyWireM.receive();
+    }
+    else{
+        pointerReg = ADS1115_NO_REG;
+    }
 #endif
     regValue = (MSByte<<8) + LSByte;
     return regValue;
@@ -128,6 +128,105 @@ typedef enum ADS1115_MUX{
 #define ADS1115_COMP_INC 0x1000     // increment to next channel
 #define ADS1015_MUX ADS1115_MUX
 
+#ifdef ADS1115_ENABLE_STATS
+struct ADS1115_Stats {
+    uint32_t registerReads[4] = {0, 0, 0, 0};   // read transactions per register
+    uint32_t registerWrites[4] = {0, 0, 0, 0};  // write transactions per register
+    uint32_t pointerWrites = 0;        // pointer register writes needed for reads
+    uint32_t resets = 0;
+    uint32_t connectionChecks = 0;     // isDisconnected()
+    uint32_t transactions = 0;         // all I2C transactions
+    uint32_t bytes = 0;                // including address bytes
+    uint32_t endTransmissionErrors[6] = {0, 0, 0, 0, 0, 0}; // index = error code, [5] = 5 or higher
+    uint32_t readErrors = 0;           // no data received
+    uint32_t busTime_us = 0;           // time spent in I2C functions
+    uint32_t delayTime_us = 0;         // time spent waiting for conversions (continuous mode)
+    uint32_t busyWaitTime_us = 0;      // time spent polling the OS bit (single shot mode)
+};
+#endif
+
+/* Bus lock hooks, see setBusLock() */
+typedef void (*ADS1115_LockFunction)(void *arg);
+
+typedef enum ADS1X15_CHIP{
+    ADS1115_CHIP = 0,
+    ADS1015_CHIP = 1
+} chipType;
+
+/* Everything that differs between the ADS1115 and the ADS1015, resolved at compile time. The 
+ * ADS1015 delivers 12 bit results, left justified in the conversion register, i.e. the register 
+ * value is result * 16 (maximum 0x7FF0). The rate codes are the same for both chips, the data 
+ * rates are not (ADS1015_128_SPS has the code of ADS1115_8_SPS).
+ */
+template<ADS1X15_CHIP CHIP>
+struct ADS1x15_ChipTraits
+{
+    static constexpr uint8_t RESOLUTION_BITS {(CHIP == ADS1015_CHIP) ? 12 : 16};
+    static constexpr uint8_t RESULT_SHIFT {16 - RESOLUTION_BITS};   // conversion register -> result
+    static constexpr int16_t FULL_SCALE_RAW {(CHIP == ADS1015_CHIP) ? 0x7FF0 : 0x7FFF};
+
+    /* Nominal conversion time in microseconds (1 / data rate) */
+    static constexpr uint32_t convTime_us(ADS1115_CONV_RATE rate){
+        return (CHIP == ADS1115_CHIP) ? 
+                  (((rate >> 5) <= 4) ? (125000UL >> (rate >> 5)) : 
+                   ((rate >> 5) == 5) ? 4000 : ((rate >> 5) == 6) ? 2106 : 1163) :
+               (((rate >> 5) == 0) ? 7813 : ((rate >> 5) == 1) ? 4000 : ((rate >> 5) == 2) ? 2041 :
+                ((rate >> 5) == 3) ? 1087 : ((rate >> 5) == 4) ? 625 : ((rate >> 5) == 5) ? 417 : 303);
+    }
+
+    /* Conversion register value -> result with RESOLUTION_BITS */
+    static constexpr int16_t toResult(int16_t raw){
+        return static_cast<int16_t>(raw >> RESULT_SHIFT);
+    }
+
+    /* Conversion register value -> microvolts (rounded), the same for both chips. One LSB is 
+     * rangeFactor * 7.8125 µV = rangeFactor * 125 / 16 µV, rangeFactor: see ADS1115_WE::rangeFactor(). 
+     * All microvolt results of the library are calculated with this function. */
+    static constexpr int32_t rawToMicrovolts(int32_t raw, uint8_t rangeFactor){
+        return (raw * rangeFactor * 125 + 8) >> 4;
+    }
+
+    /* Result -> microvolts (rounded) */
+    static constexpr int32_t resultToMicrovolts(int16_t result, uint8_t rangeFactor){
+        return rawToMicrovolts(static_cast<int32_t>(result) * (1 << RESULT_SHIFT), rangeFactor);
+    }
+};
+
+template<ADS1X15_CHIP CHIP> constexpr uint8_t ADS1x15_ChipTraits<CHIP>::RESOLUTION_BITS;
+template<ADS1X15_CHIP CHIP> constexpr uint8_t ADS1x15_ChipTraits<CHIP>::RESULT_SHIFT;
+template<ADS1X15_CHIP CHIP> constexpr int16_t ADS1x15_ChipTraits<CHIP>::FULL_SCALE_RAW;
+
+/* Raw result, tagged with the range it was measured in */
+class ADS1115_Statistics;
+
+struct ADS1115_Sample {
+    int16_t raw;
+    ADS1115_RANGE range;
+};
+
+/* One entry of a scan table: channel (single-ended or differential), range and rate. The
+ * constructor combines them to the config word at compile time, so switching to an entry is
+ * one register write. Measure mode and comparator settings are kept from the current
+ * configuration, alert limits are not rescaled.
+ *
+ * const ADS1115_ScanEntry table[] = {
+ *     {ADS1115_COMP_0_1, ADS1115_RANGE_0256, ADS1115_128_SPS},
+ *     {ADS1115_COMP_2_GND, ADS1115_RANGE_4096, ADS1115_860_SPS}
+ * };
+ */
+struct ADS1115_ScanEntry {
+    static constexpr uint16_t CONFIG_MASK {0x7EE0}; // mux, range and rate bits
+
+    constexpr ADS1115_ScanEntry(ADS1115_MUX mux, ADS1115_RANGE range, ADS1115_CONV_RATE rate) :
+        config{static_cast<uint16_t>((mux | range | rate) & CONFIG_MASK)} {}
+
+    constexpr ADS1115_MUX mux() const { return static_cast<ADS1115_MUX>(config & 0x7000); }
+    constexpr ADS1115_RANGE range() const { return static_cast<ADS1115_RANGE>(config & 0x0E00); }
+    constexpr ADS1115_CONV_RATE rate() const { return static_cast<ADS1115_CONV_RATE>(config & 0x00E0); }
+
+    uint16_t config;
+};
+
 typedef enum ADS1115_STATUS_OR_START{
     ADS1115_BUSY          = 0x0000,
     ADS1115_START_ISREADY = 0x8000,
@@ -135,6 +234,17 @@ typedef enum ADS1115_STATUS_OR_START{
     ADS1015_START_ISREADY = ADS1115_START_ISREADY
 } statusOrStart;
 
+typedef enum ADS1115_WAIT_STRATEGY{
+    ADS1115_WAIT_POLL_OS      = 0,
+    ADS1115_WAIT_POLL_RDY_PIN = 1,
+    ADS1115_WAIT_INTERRUPT    = 2,
+    ADS1115_WAIT_TIMED        = 3,
+    ADS1015_WAIT_POLL_OS      = ADS1115_WAIT_POLL_OS,
+    ADS1015_WAIT_POLL_RDY_PIN = ADS1115_WAIT_POLL_RDY_PIN,
+    ADS1015_WAIT_INTERRUPT    = ADS1115_WAIT_INTERRUPT,
+    ADS1015_WAIT_TIMED        = ADS1115_WAIT_TIMED
+} waitStrategy;
+
 
 class ADS1115_WE
 {
@@ -144,21 +254,128 @@ class ADS1115_WE
         static constexpr uint8_t ADS1115_CONFIG_REG     {0x01}; // Configuration Register
         static constexpr uint8_t ADS1115_LO_THRESH_REG  {0x02}; // Low Threshold Register
         static constexpr uint8_t ADS1115_HI_THRESH_REG  {0x03}; // High Threshold Register
+        static constexpr uint8_t ADS1115_NO_REG         {0xFF}; // Pointer register state unknown
 
         /* other */
         static constexpr uint16_t ADS1115_REG_FACTOR    {32768};
         static constexpr uint16_t ADS1115_REG_RESET_VAL {0x8583};
 
+        /* Compile time helpers, e.g. for ADS1x15<> (ADS1x15.h) */
+
+        /* Voltage range in millivolts. The two reserved codes above ADS1115_RANGE_0256 also mean 256 mV. */
+        static constexpr uint16_t rangeToMillivolts(ADS1115_RANGE range){
+            return ((range >> 9) == 0) ? 6144 : (((range >> 9) >= 5) ? 256 : (8192 >> (range >> 9)));
+        }
+
+        /* Voltage range in multiples of 256 mV (24, 16, 8, 4, 2, 1). One LSB is factor * 7.8125 µV. */
+        static constexpr uint8_t rangeFactor(ADS1115_RANGE range){
+            return ((range >> 9) == 0) ? 24 : (((range >> 9) >= 5) ? 1 : (32 >> (range >> 9)));
+        }
+
+        /* Raw value -> millivolts as Q16.16 fixed point number (exact), see getResult_mV_fixed() */
+        static constexpr int32_t rawToMillivoltsFixed(int16_t raw, uint16_t voltageRange){
+            return static_cast<int32_t>(raw) * voltageRange * 2;
+        }
+
+        /* Raw value -> microvolts (rounded), see ADS1x15_ChipTraits::rawToMicrovolts() */
+        static constexpr int32_t rawToMicrovolts(int16_t raw, uint8_t rangeFactor){
+            return ADS1x15_ChipTraits<ADS1115_CHIP>::rawToMicrovolts(raw, rangeFactor);
+        }
+
+        /* Nominal conversion time in microseconds (1 / data rate), see ADS1x15_ChipTraits */
+        static constexpr uint32_t convTime_us(ADS1X15_CHIP chip, ADS1115_CONV_RATE rate){
+            return (chip == ADS1015_CHIP) ? ADS1x15_ChipTraits<ADS1015_CHIP>::convTime_us(rate) :
+                                            ADS1x15_ChipTraits<ADS1115_CHIP>::convTime_us(rate);
+        }
+
+        /* Largest raw value of the chip (conversion register format), see ADS1x15_ChipTraits */
+        static constexpr int16_t fullScaleRaw(ADS1X15_CHIP chip){
+            return (chip == ADS1015_CHIP) ? ADS1x15_ChipTraits<ADS1015_CHIP>::FULL_SCALE_RAW :
+                                            ADS1x15_ChipTraits<ADS1115_CHIP>::FULL_SCALE_RAW;
+        }
+
+        /* Raw value (conversion register format) of a voltage in the given range, limited to 
+         * -32768...32767. Use it to precompute alert limits, e.g. for ADS1115_EventMonitor: 
+         * static constexpr int16_t limit = ADS1115_WE::millivoltsToRaw(ADS1115_RANGE_4096, 3300);
+         */
+        static constexpr int16_t millivoltsToRaw(ADS1115_RANGE range, int32_t millivolts){
+            return limitToInt16(roundedQuotient(millivolts * 128, rangeFactor(range)));
+        }
+
+        /* getResultWithRange(min, max) for a raw value: like map(raw, -32768, 32767, min, max), 
+         * but rounded */
+        static constexpr int16_t rawToRange(int16_t raw, int16_t min, int16_t max){
+            return static_cast<int16_t>((max >= min) ? 
+                       (min + scaleToSpan(raw, static_cast<uint32_t>(static_cast<int32_t>(max) - min))) :
+                       (min - scaleToSpan(raw, static_cast<uint32_t>(static_cast<int32_t>(min) - max))));
+        }
+
+        /* Second step of getResultWithRange(min, max, maxMillivolt): value * voltageRange / 
+         * maxMillivolt, rounded half away from zero. maxMillivolt = 0 gives the limit with the 
+         * sign of the value (0 for 0). */
+        static constexpr int16_t rangeToMillivoltScale(int16_t value, uint16_t voltageRange, int16_t maxMillivolt){
+            return (maxMillivolt == 0) ? ((value > 0) ? 32767 : ((value < 0) ? -32768 : 0)) :
+                   static_cast<int16_t>(roundedQuotient(static_cast<int32_t>(value) * voltageRange, maxMillivolt));
+        }
+
+        /* num / den, rounded half away from zero, den != 0 */
+        static constexpr int32_t roundedQuotient(int32_t num, int32_t den){
+            return (num + (((num < 0) != (den < 0)) ? -(((den < 0) ? -den : den) / 2) : 
+                                                      (((den < 0) ? -den : den) / 2))) / den;
+        }
+
 #ifndef USE_TINY_WIRE_M_   
-                ADS1115_WE(const uint8_t addr = 0x48) : _wire{&Wire}, i2cAddress{addr} {}
-                ADS1115_WE(TwoWire *w, const uint8_t addr = 0x48) : _wire{w}, i2cAddress{addr} {}
+                ADS1115_WE(const uint8_t addr = 0x48) : ADS1115_WE(&Wire, addr) {}
+                ADS1115_WE(TwoWire *w, const uint8_t addr = 0x48) : _wire{w}, i2cAddress{addr}, 
+                    useADS1015{false}, configTransaction{false}, autoRangeMode{false}, 
+                    predictiveAutoRange{false}, rememberChannelRanges{false}, rangeSettling{false}
+#ifndef ADS1115_NO_HS_MODE
+                    , hsSession{false}
+#endif
+                    {}
 #else
-                ADS1115_WE(const uint8_t addr = 0x48) : i2cAddress{addr} {}
+                ADS1115_WE(const uint8_t addr = 0x48) : i2cAddress{addr}, 
+                    useADS1015{false}, configTransaction{false}, autoRangeMode{false}, 
+                    predictiveAutoRange{false}, rememberChannelRanges{false}, rangeSettling{false}
+#ifndef ADS1115_NO_HS_MODE
+                    , hsSession{false}
+#endif
+                    {}
 #endif   
 
         void reset();
+
+        /* init(true) tells an ADS1115_WE object that it controls an ADS1015. With an ADS1015_WE 
+         * object (ADS1015_WE.h), the chip is known from the type. 
+         */
         bool init(bool ads1015 = false);
         uint8_t isDisconnected();
+        ADS1X15_CHIP getChip();
+
+        /* The library keeps a copy of the config and the threshold registers. Setters and 
+         * getters work on this copy instead of reading the registers first. If the ADS1115 
+         * might have lost its settings (e.g. after a power cycle or a general call reset by 
+         * another device), call this function to read the registers again. It returns true 
+         * if the registers still matched the copy. If the device does not answer, the copy is 
+         * kept and the function returns false. Register writes which are not acknowledged do 
+         * not change the copy.
+         */
+        bool resyncFromDevice();
+
+        /* Collect several settings and write them with as few I2C transactions as possible.
+         * Between beginConfig() and commitConfig() the setters (setVoltageRange_mV, setConvRate,
+         * setCompareChannels, setMeasureMode, setAlertPinMode, ...) only change the register 
+         * copies. commitConfig() writes each changed register exactly once and waits only once 
+         * for new results in continuous mode. Do not request results before commitConfig().
+         *
+         * adc.beginConfig();
+         * adc.setVoltageRange_mV(ADS1115_RANGE_4096);
+         * adc.setCompareChannels(ADS1115_COMP_1_GND);
+         * adc.setConvRate(ADS1115_860_SPS);
+         * adc.commitConfig();
+         */
+        void beginConfig();
+        void commitConfig();
 
         /* Set number of conversions after which the alert pin will be active
          * - or you can disable the alert
@@ -199,7 +416,15 @@ class ADS1115_WE
          * ADS1115_MAX_LIMIT
          * ADS1115_WINDOW
          */
+#ifndef ADS1115_NO_FLOAT
         void setAlertModeAndLimit_V(ADS1115_COMP_MODE mode, float hithres, float lothres);
+#endif
+
+        /* Same as setAlertModeAndLimit_V(), but the limits are raw values as in the conversion 
+         * register (see millivoltsToRaw()), so no floating point arithmetic is needed. The 
+         * limits refer to the current voltage range. 
+         */
+        void setAlertModeAndLimit_raw(ADS1115_COMP_MODE mode, int16_t hiThres, int16_t loThres);
 
         /* Set the conversion rate in SPS (samples per second)
          * Options should be self-explaining:
@@ -218,6 +443,32 @@ class ADS1115_WE
         /* returns the conversion rate */
         convRate getConvRate();
 
+        /* Measures the actual conversion time at the current rate. The internal oscillator of
+         * the ADS1115 is only accurate to +/-10%, so by default all waits (setVoltageRange_mV(),
+         * setCompareChannels(), setAutoRange(), ...) contain a generous reserve. After the 
+         * calibration they use the measured conversion time plus ~3%. All rates are derived 
+         * from the same oscillator, so one calibration applies to all rates. 
+         * The conversion ready edges of the alert pin are timed if a ready pin is set (see 
+         * setReadyPin()), otherwise single shot conversions are polled via the OS bit. The 
+         * polling resolves the conversion time only to one register read, so calibrate at a 
+         * low rate, e.g. 64 SPS at 100 kHz or 250 SPS at 400 kHz, and switch to the rate you 
+         * need afterwards (ADS1015 at 100 kHz: only with a ready pin). 
+         * Returns false (and keeps the previous calibration) if the ADS1115 did not respond in 
+         * time, if the polling is too coarse for the rate or if the result is more than 15% 
+         * off the nominal conversion time (the datasheet specifies +/-10%). 
+         */
+#ifndef ADS1115_NO_CALIBRATION
+        bool calibrateConvRate(uint8_t conversions = 8);
+        void resetConvRateCalibration();
+#endif
+        
+        /* Conversion time at the current rate in microseconds, calibrated if available */
+        uint32_t getConvTime_us();
+
+        /* Upper limit of the conversion time at the current rate in microseconds (calibrated 
+         * + ~3%, else nominal + 10%), the time the library waits at most for one conversion */
+        uint32_t getMaxConvTime_us();
+
         /* Set continuous or single shot mode:
          *
          * ADS1115_CONTINUOUS  ->  continuous mode
@@ -256,6 +507,7 @@ class ADS1115_WE
          * Please be aware that the procedure takes the the time needed for several conversions.
          * You should ony use it in case you expect stable or slowly changing voltages. 
          */
+#ifndef ADS1115_NO_AUTO_RANGE
         void setAutoRange();
         
         /* Set the automatic voltage range permanantly, but the range will only be changed if the 
@@ -263,13 +515,35 @@ class ADS1115_WE
          * Therefore this method is faster than setAutoRange(). 
          */
         void setPermanentAutoRangeMode(bool autoMode);
+
+        /* Non-blocking alternative to setPermanentAutoRangeMode(): getSample() predicts the 
+         * best range from the last result and the range it was measured in, and switches 
+         * directly to it (no re-measurement in the 6144 mV range). A new range is chosen if 
+         * the result is above the upper or below the lower threshold. On saturation, it 
+         * jumps to the 6144 mV range.
+         */
+        void setPredictiveAutoRange(bool predictive);
+        
+        /* Thresholds in percent of the full scale, default: 40 / 90. lowerPercent should be 
+         * less than half of upperPercent, otherwise the range can toggle. 
+         */
+        void setAutoRangeThresholds(uint8_t lowerPercent, uint8_t upperPercent);
+#endif
+
+        /* Changes the range without waiting, like setCompareChannels_nonblock(). In continuous 
+         * mode, getSample() does not deliver results until the first conversion in the new 
+         * range is completed. 
+         */
+        void setVoltageRange_mV_nonblock(ADS1115_RANGE range);
         
         /* If you work with the automatic range selection, it makes sense to save the current 
          * range before changing the channel. If you change back, the former range will be set 
          * automatically. This will avoid unnecessary measurements to determine the optimum range
          * repeatedly.
          */
+#ifndef ADS1115_NO_CHANNEL_RANGES
         void setRememberChannelRanges(bool rememberChannelRanges);
+#endif
 
         /* Set the inputs to be compared
          *
@@ -291,13 +565,52 @@ class ADS1115_WE
         /* Set to channel (0-3) in single ended mode
          */
         void setSingleChannel(size_t channel);
+
+        /* Switches channel, range and rate of a scan table entry (see ADS1115_ScanEntry) with one
+         * register write. In continuous mode, setScanEntry() waits for the first result of the 
+         * new entry, setScanEntry_nonblock() does not wait (getSample() returns false until the
+         * result is available). The ranges remembered with setRememberChannelRanges() are not 
+         * applied. 
+         */
+        void setScanEntry(const ADS1115_ScanEntry &entry);
+        void setScanEntry_nonblock(const ADS1115_ScanEntry &entry);
         
         //void setAllChannelRanges(uint8_t, uint8_t, uint8_t, uint8_t, uint8_t, uint8_t, uint8_t,
 
         bool isBusy();
+
+        /* Single shot mode, without I2C access: true if the minimum conversion time of the 
+         * conversion started last has passed (calibrated if available, else nominal - 10%). 
+         * For loops which poll the state: if(adc.isConvDue() && !adc.isBusy()){...} 
+         * isConvOverdue() is true if the conversion should have been completed long ago 
+         * (3 x maximum conversion time, the timeout of waitForConversion()), e.g. device lost. 
+         */
+        bool isConvDue();
+        bool isConvOverdue();
         void startSingleMeasurement();
+
+        /* Changes the channel and starts a single shot conversion with one register write.
+         * The ranges remembered with setRememberChannelRanges() are not applied.
+         */
+        void startSingleMeasurement(ADS1115_MUX mux);
+
+        /* Switches to a scan table entry and starts a single shot conversion with one register
+         * write.
+         */
+        void startSingleMeasurement(const ADS1115_ScanEntry &entry);
+#ifndef ADS1115_NO_FLOAT
         float getResult_V();
         float getResult_mV();
+#endif
+
+        /* Integer results, no floating point arithmetic: 
+         * getResult_uV() returns microvolts, rounded to 1 µV (the LSB is 7.8125 µV in the 
+         * 256 mV range and 187.5 µV in the 6144 mV range). 
+         * getResult_mV_fixed() returns millivolts as Q16.16 fixed point number, i.e. 
+         * millivolts * 65536. The value is exact. Integer millivolts: (result + 32768) >> 16.
+         */
+        int32_t getResult_uV();
+        int32_t getResult_mV_fixed();
         
         /* Get the raw result from the conversion register: 
          * The conversion register contains the conversion result of the amplified (!)
@@ -306,12 +619,147 @@ class ADS1115_WE
          * +32767 is 6144 mV; if the range is 4096 mV, +32767 is 4096 mV, and so on.  
          */
         int16_t getRawResult();
+
+        /* getRawResult() for interrupt service routines (ADS1115_Acquisition, read in ISR): 
+         * no bus lock (an RTOS mutex must not be taken in an ISR), no auto range, not counted 
+         * by getStats(). Attached statistics are updated. 
+         */
+        int16_t getRawResultInISR();
+
+        /* Never blocks. Returns the raw result tagged with the range it was measured in 
+         * and applies the predictive auto range (if enabled). Returns false in continuous 
+         * mode while a result of the current range is not yet available after a range change. 
+         * In single shot mode the result belongs to the last started conversion. 
+         */
+        bool getSample(ADS1115_Sample &sample);
+
+        /* Every result of the mux setting read with getRawResult() (and the functions based 
+         * on it) or getSample() is added to stats. Use a separate ADS1115_Statistics object 
+         * for each mux setting. Each conversion should only be read once, since every read 
+         * counts as a sample. 
+         */
+#ifndef ADS1115_NO_STATISTICS
+        void attachStatistics(ADS1115_Statistics &stats, ADS1115_MUX mux);
+        void detachStatistics(ADS1115_MUX mux);
+#endif
+
+        /* Captures n consecutive conversions of the current channel into buf, optionally 
+         * with the time (micros()) at which each result was ready. Auto range and attached 
+         * statistics are not applied. The settings are restored afterwards. 
+         * With a ready pin (see setReadyPin()), the ADS1115 runs in continuous mode with the 
+         * alert pin as conversion ready signal, so the full data rate is reached as long as 
+         * the bus is fast enough. Without, single shot conversions are chained using the 
+         * OS bit; the next conversion is started before the result is read if there is 
+         * enough time. 
+         * Returns the number of captured results (less than n if the device did not 
+         * respond in time). 
+         */
+        size_t readBlock(int16_t *buf, size_t n, uint32_t *timestamps = nullptr);
+        
+        /* Conversions which were missed by the last readBlock() (only with ready pin) */
+        uint16_t getMissedConversions();
+        
+        /* Pin the ALERT/RDY pin is connected to, used by readBlock(). -1 = none (default). 
+         * Set the pin mode (INPUT or INPUT_PULLUP) yourself. 
+         */
+        void setReadyPin(int8_t pin);
+        int8_t getReadyPin();
+
+        /* State of the ALERT/RDY signal, e.g. for classes which use the comparator alert: 
+         * isReadyPinActive()    -> the ready pin is at the active level (setAlertPinMode(), 
+         *                          ADS1115_ACT_LOW / ADS1115_ACT_HIGH), false without pin
+         * getReadyEvents()      -> calls of notifyConversionReady() since clearReadyEvents() 
+         *                          (up to 255, always 0 with ADS1115_NO_WAIT_STRATEGY)
+         * waitForReadySignal()  -> waits for a ready event (ADS1115_WAIT_INTERRUPT, sleeps on 
+         *                          AVR boards) or the active ready pin. Returns false after 
+         *                          maxTime_us.
+         */
+        bool isReadyPinActive();
+        uint8_t getReadyEvents();
+        void clearReadyEvents();
+        bool waitForReadySignal(uint32_t maxTime_us);
+
+        /* How the library waits for conversions (setAutoRange(), setCompareChannels(), 
+         * setVoltageRange_mV() and commitConfig() in continuous mode, readBlock() without 
+         * ready pin, waitForConversion()):
+         *
+         * ADS1115_WAIT_POLL_OS      ->  sleeps until the earliest possible end of the conversion, 
+         *                               then polls the OS bit via I2C (see setPollBackoff()). 
+         *                               Continuous mode: timed (default)
+         * ADS1115_WAIT_POLL_RDY_PIN ->  polls the ready pin with digitalRead() (see setReadyPin())
+         * ADS1115_WAIT_INTERRUPT    ->  waits for notifyConversionReady(), called by your ISR. 
+         *                               Sleeps (idle mode) between interrupts on AVR boards.
+         * ADS1115_WAIT_TIMED        ->  waits the maximum conversion time (calibrated if 
+         *                               calibrateConvRate() was called), no bus traffic
+         *
+         * The pin and interrupt strategies need the alert pin as conversion ready signal 
+         * (setAlertPinMode() and setAlertPinToConversionReady()), otherwise the waits are timed. 
+         * If the signal does not come in time, they end after the maximum conversion time. 
+         */
+#ifndef ADS1115_NO_WAIT_STRATEGY
+        void setWaitStrategy(ADS1115_WAIT_STRATEGY strategy);
+#endif
+        ADS1115_WAIT_STRATEGY getWaitStrategy();
+        
+#ifndef ADS1115_NO_WAIT_STRATEGY
+        /* ADS1115_WAIT_POLL_OS: the interval between two polls starts with firstInterval_us and 
+         * is doubled after each poll up to maxInterval_us. 0, 0 (default) = fixed interval of 1/8 
+         * of the conversion time tolerance (2.5% of the conversion time, less after calibration). 
+         */
+        void setPollBackoff(uint16_t firstInterval_us, uint16_t maxInterval_us);
+#endif
+        
+        /* Single shot mode: waits until the conversion in progress is completed. Continuous 
+         * mode: waits for the next result. Returns false if the completion was not signalled 
+         * in time. 
+         */
+        bool waitForConversion();
+        
+        /* Call it from the ISR attached to the ready pin (ADS1115_WAIT_INTERRUPT): 
+         *
+         * void convReadyISR(){ adc.notifyConversionReady(); }
+         * attachInterrupt(digitalPinToInterrupt(pin), convReadyISR, FALLING);
+         */
+#ifndef ADS1115_NO_WAIT_STRATEGY
+        void notifyConversionReady();
+#endif
+        
+        /* Optional lock for a bus which is shared by several tasks (RTOS). lock(arg) and 
+         * unlock(arg) are called around every I2C transaction sequence (register access, reset,
+         * the register writes of commitConfig() and resyncFromDevice()), but never while 
+         * waiting for a conversion. The calls can be nested, so use a recursive mutex. An 
+         * ADS1115_WE object itself should only be used by one task, see ADS1115_AcquisitionTask.
+         *
+         * adc.setBusLock([](void *m){ xSemaphoreTakeRecursive((SemaphoreHandle_t)m, portMAX_DELAY); },
+         *                [](void *m){ xSemaphoreGiveRecursive((SemaphoreHandle_t)m); }, busMutex);
+         */
+#ifndef ADS1115_NO_BUS_LOCK
+        void setBusLock(ADS1115_LockFunction lock, ADS1115_LockFunction unlock, void *arg = nullptr);
+#endif
+
+        /* Hs-mode session (I2C up to 3.4 MHz), e.g. to read an ADS1015 at 3300 SPS. Only for
+         * cores which can run the bus at hsClock and which do not send a STOP after a NACK. 
+         * The master code (0x08, 0x0A, 0x0C or 0x0E) is sent at fsClock, then the clock is 
+         * switched to hsClock. Until endHsSession(), all transfers end with a repeated START 
+         * instead of a STOP, since a STOP ends the Hs-mode. The bus lock (see setBusLock()) is 
+         * held and no other device on the bus may be used meanwhile. If the ADS1115 does not 
+         * answer in Hs-mode, the clock is set back to fsClock and false is returned, the 
+         * library then continues as before. reset() ends the session. 
+         */
+#ifndef ADS1115_NO_HS_MODE
+        bool beginHsSession(uint32_t hsClock = 3400000, uint32_t fsClock = 400000, uint8_t masterCode = 0x08);
+        
+        /* Sends a STOP (address only transfer) and sets the clock back to fsClock */
+        void endHsSession();
+        bool isHsSession();
+#endif
         
         /* Scaling of the result to a different range: 
          * The results in the conversion register are in a range of -32767 to +32767
          * You might want to receive the result in a different scale, e.g. -1023 to 1023.
          * For -1023 to 1023, and if you have chosen e.g. ADS1115_RANGE_4096, 0 Volt would 
          * give 0 as result and 4096 mV would give 1023. -4096 mV would give -1023.
+         * The result is rounded (up to version 1.5.8 truncated like map()). 
          */
         int16_t getResultWithRange(int16_t min, int16_t max);
         
@@ -321,7 +769,8 @@ class ADS1115_WE
          * would choose getResultWithRange(-1023, 1023, 5000). A difference to the Arduino 
          * UNO is that you can measure negative voltages. 
          * You have to ensure that the voltage range you scale to is smaller than the 
-         * measuring voltage range.
+         * measuring voltage range. Rounded half away from zero, maxVoltage = 0 gives 32767 
+         * (-32768 for negative results), see rangeToMillivoltScale(). 
          */
         int16_t getResultWithRange(int16_t min, int16_t max, int16_t maxVoltage);
         
@@ -329,23 +778,133 @@ class ADS1115_WE
          * In order to deactivate, use the setAlertLimit_V function
          */
         void setAlertPinToConversionReady();
-        void clearAlert();
+
+        /* Reads the conversion register, which clears a latched alert. Returns the value read 
+         * (raw, no auto range, no attached statistics). 
+         */
+        int16_t clearAlert();
+
+#ifdef ADS1115_ENABLE_STATS
+        /* Snapshot and reset of the I2C transaction and waiting time counters. Only available 
+         * if ADS1115_ENABLE_STATS is defined in ADS1115_config.h.
+         */
+        ADS1115_Stats getStats();
+        void resetStats();
+#endif
 
 
     protected:
+        /* (raw + 32768) * absSpan / 65535, rounded. At most 65535 * 65535 + 32767, fits into uint32_t. */
+        static constexpr int32_t scaleToSpan(int16_t raw, uint32_t absSpan){
+            return static_cast<int32_t>((static_cast<uint32_t>(static_cast<int32_t>(raw) + 32768) * absSpan + 32767) / 65535);
+        }
+
+        static constexpr int16_t limitToInt16(int32_t val){
+            return (val > 32767) ? 32767 : ((val < -32768) ? -32768 : static_cast<int16_t>(val));
+        }
+
 #ifndef USE_TINY_WIRE_M_    
         TwoWire *_wire;
 #endif
-        bool useADS1015;
         uint16_t voltageRange;
+        uint16_t confRegShadow = ADS1115_REG_RESET_VAL & ~(0x8000); // without OS bit
+        uint16_t loThreshShadow = 0x8000;
+        uint16_t hiThreshShadow = 0x7FFF;
+        uint8_t pendingRegs = 0;        // bit n set = register n has to be written on commit
+        uint8_t pendingConvWaits = 0;   // conversions to wait for on commit (continuous mode)
         uint8_t i2cAddress;
-        bool autoRangeMode;
+        /* flags as bit fields, one byte instead of one per flag (initialized by the constructor) */
+        bool useADS1015 : 1;
+        bool configTransaction : 1;
+        bool autoRangeMode : 1;
+        bool predictiveAutoRange : 1;
+        bool rememberChannelRanges : 1;
+        bool rangeSettling : 1;             // continuous mode: new range not yet in the results
+#ifndef ADS1115_NO_HS_MODE
+        bool hsSession : 1;
+        uint32_t hsFsClock = 400000;
+#else
+        static constexpr bool hsSession = false;
+#endif
+        uint8_t pointerReg = ADS1115_NO_REG; // last value written to the pointer register
+#ifndef ADS1115_NO_AUTO_RANGE
+        int16_t autoRangeLower = 13107;     // 40%
+        int16_t autoRangeUpper = 29491;     // 90%
+#endif
+        uint16_t convConfig = ADS1115_REG_RESET_VAL & ~(0x8000); // config of the last single shot conversion
+#ifndef ADS1115_NO_STATISTICS
+        ADS1115_Statistics *channelStats[8] = {nullptr}; // per mux setting
+#endif
+        int8_t readyPin = -1;
+#ifndef ADS1115_NO_CALIBRATION
+        uint16_t convTimeFactor = 0;        // measured / nominal conversion time * 4096, 0 = not calibrated
+#else
+        static constexpr uint16_t convTimeFactor = 0;
+#endif
+        uint16_t blockMissed = 0;
+#ifndef ADS1115_NO_WAIT_STRATEGY
+        ADS1115_WAIT_STRATEGY convWaitStrategy = ADS1115_WAIT_POLL_OS;
+        uint16_t pollFirstInterval = 0;
+        uint16_t pollMaxInterval = 0;
+        volatile uint8_t readyEvents = 0;   // counted by notifyConversionReady()
+#else
+        static constexpr ADS1115_WAIT_STRATEGY convWaitStrategy = ADS1115_WAIT_POLL_OS;
+        static constexpr uint16_t pollFirstInterval = 0;
+        static constexpr uint16_t pollMaxInterval = 0;
+#endif
+        unsigned long convStartTime = 0;    // start of the last single shot conversion
+#ifndef ADS1115_NO_BUS_LOCK
+        ADS1115_LockFunction busLock = nullptr;
+        ADS1115_LockFunction busUnlock = nullptr;
+        void *busLockArg = nullptr;
+#endif
+        unsigned long rangeSwitchTime = 0;
+        unsigned long rangeSettleTime = 0;
+#ifndef ADS1115_NO_AUTO_RANGE
+        ADS1115_RANGE predictRange(int16_t raw, ADS1115_RANGE measRange);
+#endif
+        uint16_t resultConfig();
+        void updateStatistics(int16_t raw, uint16_t conf);
+        void selectChip(ADS1X15_CHIP chip);
+        uint32_t nominalConvTime_us(convRate cr);
+        uint32_t maxConvTime_us(convRate cr);
+        uint32_t minConvTime_us(convRate cr);
+        bool useReadySignal();
+        bool pollOsBit(convRate rate);
+        bool waitForReadyPin(unsigned long startTime, uint32_t maxTime);
+#ifndef ADS1115_NO_WAIT_STRATEGY
+        bool waitForReadyEvents(uint8_t events, unsigned long startTime, uint32_t maxTime);
+#endif
+        bool waitForReadyEdges(uint8_t edges);
+        void delayMicros(uint32_t us);
+        size_t readBlockReadyPin(int16_t *buf, size_t n, uint32_t *timestamps);
+        size_t readBlockSingleShot(int16_t *buf, size_t n, uint32_t *timestamps);
         void delayAccToRate(convRate cr);
-        bool rememberChannelRanges;
-        uint8_t channelRange[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+#ifndef ADS1115_NO_CHANNEL_RANGES
+        uint8_t channelRanges[4] = {0, 0, 0, 0}; // range code per mux setting, two per byte
+#endif
+        void rescaleLimits(uint16_t oldVoltageRange);
+#ifndef ADS1115_NO_FLOAT
         int16_t calcLimit(float rawLimit);
+#endif
+        void writeConfReg(uint16_t val);
+        void writeThreshReg(uint8_t reg, uint16_t val);
+        void waitForNewResults(uint8_t conversions);
+        bool busyWait();
+#ifdef ADS1115_ENABLE_STATS
+        ADS1115_Stats stats;
+        void recordTransaction(uint8_t bytes, uint8_t err, unsigned long duration);
+#endif
+#ifndef ADS1115_NO_BUS_LOCK
+        void lockBus();
+        void unlockBus();
+#else
+        void lockBus(){}
+        void unlockBus(){}
+#endif
         uint8_t writeRegister(uint8_t reg, uint16_t val);
         uint16_t readRegister(uint8_t reg);
+        uint16_t readRegisterUnlocked(uint8_t reg);
     };
 #endif
 
@@ -2,4 +2,39 @@
 #define ADS1115_CONFIG_H_
 /* Uncomment the following line to use TinyWireM instead of Wire */
 //#define USE_TINY_WIRE_M_
+/* Uncomment the following line to count I2C transactions, bytes, errors and waiting 
+   times per ADS1115_WE object (see getStats()). Costs some flash, RAM and time. */
+//#define ADS1115_ENABLE_STATS
+/* Uncomment the following line for small MCUs like the ATtiny85 (8 KB flash, 512 bytes RAM). 
+   It removes the features below. You can also remove them separately. */
+//#define ADS1115_TINY
+/* Auto range: setAutoRange(), setPermanentAutoRangeMode(), setPredictiveAutoRange() */
+//#define ADS1115_NO_AUTO_RANGE
+/* Range memory per channel: setRememberChannelRanges() */
+//#define ADS1115_NO_CHANNEL_RANGES
+/* Float results and limits: getResult_V(), getResult_mV(), setAlertModeAndLimit_V() and 
+   the float functions of ADS1115_Scanner and ADS1115_Array. Use the integer functions. */
+//#define ADS1115_NO_FLOAT
+/* Statistics per channel: attachStatistics() */
+//#define ADS1115_NO_STATISTICS
+/* Wait strategies and ready events: setWaitStrategy(), setPollBackoff(), notifyConversionReady(). 
+   Conversions are polled via the OS bit (or the ready pin in readBlock()). */
+//#define ADS1115_NO_WAIT_STRATEGY
+/* Hs-mode sessions: beginHsSession(), endHsSession() */
+//#define ADS1115_NO_HS_MODE
+/* Bus lock for RTOS tasks: setBusLock() */
+//#define ADS1115_NO_BUS_LOCK
+/* Conversion time calibration: calibrateConvRate(), the nominal times +/-10% are used */
+//#define ADS1115_NO_CALIBRATION
+
+#ifdef ADS1115_TINY
+#define ADS1115_NO_AUTO_RANGE
+#define ADS1115_NO_CHANNEL_RANGES
+#define ADS1115_NO_FLOAT
+#define ADS1115_NO_STATISTICS
+#define ADS1115_NO_WAIT_STRATEGY
+#define ADS1115_NO_HS_MODE
+#define ADS1115_NO_BUS_LOCK
+#define ADS1115_NO_CALIBRATION
+#endif
 #endif
\ No newline at end of file
@@ -0,0 +1,168 @@
+/******************************************************************************
+ *
+ * This is a library for the ADS1115 and ADS1015 A/D Converter
+ *
+ * ADS1x15<CHIP, ADDRESS, RANGE, RATE> is a variant of ADS1115_WE for setups with a
+ * fixed chip, address, voltage range and data rate. Config words, LSB size,
+ * conversion time and limits are calculated at compile time, results are scaled
+ * with integer multiplications and shifts. Only these and the waits of readSingle()
+ * are compile time: ADS1x15<> derives from ADS1115_WE, so the object has the same
+ * runtime state (register copies, wait strategy, ...) and all other functions
+ * remain available.
+ *
+ * ADS1x15<ADS1115_CHIP, 0x48, ADS1115_RANGE_4096, ADS1115_860_SPS> adc;
+ *
+ * Written by Wolfgang (Wolle) Ewald
+ * https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
+ * https://wolles-elektronikkiste.de/ads1115 (German)
+ *
+ ******************************************************************************/
+
+#ifndef ADS1X15_H_
+#define ADS1X15_H_
+
+#include "ADS1115_WE.h"
+
+template<ADS1X15_CHIP CHIP, uint8_t ADDRESS, ADS1115_RANGE RANGE, ADS1115_CONV_RATE RATE>
+class ADS1x15 : public ADS1115_WE
+{
+    static_assert((RANGE & ~0x0E00) == 0, "RANGE must be one of the ADS1115_RANGE values");
+    static_assert((RATE & ~0x00E0) == 0, "RATE must be one of the ADS1115_CONV_RATE values");
+
+    public:
+        typedef ADS1x15_ChipTraits<CHIP> Traits;
+
+        static constexpr uint16_t VOLTAGE_RANGE_MV {rangeToMillivolts(RANGE)};
+        static constexpr uint8_t RANGE_FACTOR {rangeFactor(RANGE)};
+        static constexpr uint32_t CONV_TIME_US {Traits::convTime_us(RATE)};
+        static constexpr uint32_t MIN_CONV_TIME_US {CONV_TIME_US - CONV_TIME_US / 10}; // -10% tolerance
+        static constexpr uint32_t MAX_CONV_TIME_US {CONV_TIME_US + CONV_TIME_US / 10}; // +10% tolerance
+        static constexpr uint32_t POLL_INTERVAL_US {(MAX_CONV_TIME_US - MIN_CONV_TIME_US) / 8 + 1};
+
+        /* Complete config word: comparator disabled, OS bit not set */
+        static constexpr uint16_t configWord(ADS1115_MUX mux, ADS1115_MEASURE_MODE mode){
+            return mux | RANGE | mode | RATE | ADS1115_DISABLE_ALERT;
+        }
+
+        /* Raw value -> microvolts: raw * RANGE_FACTOR * 7.8125 µV */
+        static constexpr int32_t rawToMicrovolts(int16_t raw){
+            return Traits::rawToMicrovolts(raw, RANGE_FACTOR);
+        }
+
+        /* Raw value -> millivolts (rounded): raw * RANGE_FACTOR / 128 */
+        static constexpr int16_t rawToMillivolts(int16_t raw){
+            return static_cast<int16_t>((static_cast<int32_t>(raw) * RANGE_FACTOR + 64) >> 7);
+        }
+
+        /* Millivolts -> raw value, e.g. for alert limits */
+        static constexpr int16_t millivoltsToRaw(int32_t mV){
+            return ADS1115_WE::millivoltsToRaw(RANGE, mV);
+        }
+
+#ifndef USE_TINY_WIRE_M_
+        ADS1x15() : ADS1115_WE(ADDRESS) { selectChip(CHIP); }
+        ADS1x15(TwoWire *w) : ADS1115_WE(w, ADDRESS) { selectChip(CHIP); }
+#else
+        ADS1x15() : ADS1115_WE(ADDRESS) { selectChip(CHIP); }
+#endif
+
+        /* Writes the complete configuration once (single shot mode, channel 0 vs. GND) */
+        bool init(){
+            if(isDisconnected()){
+                return false;
+            }
+            writeRegister(ADS1115_CONFIG_REG, configWord(ADS1115_COMP_0_GND, ADS1115_SINGLE));
+            writeRegister(ADS1115_LO_THRESH_REG, 0x8000);
+            writeRegister(ADS1115_HI_THRESH_REG, 0x7FFF);
+            voltageRange = VOLTAGE_RANGE_MV;
+            autoRangeMode = false;
+            rememberChannelRanges = false;
+            return resyncFromDevice();
+        }
+
+        /* Selects the channel and starts a single shot conversion with one register write */
+        template<ADS1115_MUX MUX>
+        void startSingleMeasurement(){
+            writeRegister(ADS1115_CONFIG_REG, configWord(MUX, ADS1115_SINGLE) | ADS1115_START_ISREADY);
+        }
+
+        /* Selects the channel and starts continuous mode with one register write */
+        template<ADS1115_MUX MUX>
+        void startContinuous(){
+            writeRegister(ADS1115_CONFIG_REG, configWord(MUX, ADS1115_CONTINUOUS));
+        }
+
+        /* Single shot conversion. The waits are fixed at compile time: ADS1115_WAIT_POLL_OS 
+         * (default) sleeps MIN_CONV_TIME_US, then polls the OS bit every POLL_INTERVAL_US (1/8 of 
+         * the tolerance), ADS1115_WAIT_TIMED sleeps MAX_CONV_TIME_US. calibrateConvRate() and 
+         * setPollBackoff() are not used here. The pin and interrupt strategies wait with 
+         * waitForConversion(), see setWaitStrategy(). */
+        template<ADS1115_MUX MUX>
+        int16_t readSingle(){
+            startSingleMeasurement<MUX>();
+#ifdef ADS1115_ENABLE_STATS
+            unsigned long startTime = micros();
+#endif
+            if(convWaitStrategy == ADS1115_WAIT_TIMED){
+                delayFixed<MAX_CONV_TIME_US>();
+            }
+            else if(convWaitStrategy == ADS1115_WAIT_POLL_OS){
+                delayFixed<MIN_CONV_TIME_US>();
+                while(isBusy() && ((micros() - convStartTime) <= 3 * MAX_CONV_TIME_US)){
+                    delayFixed<POLL_INTERVAL_US>();
+                }
+            }
+            else{
+                waitForConversion();
+            }
+#ifdef ADS1115_ENABLE_STATS
+            stats.busyWaitTime_us += micros() - startTime;
+#endif
+            return getRawResult();
+        }
+
+        /* Raw conversion register, no auto range, no attached statistics */
+        int16_t getRawResult(){
+            return readRegister(ADS1115_CONV_REG);
+        }
+
+        /* Result with the native resolution (Traits::RESOLUTION_BITS), e.g. -2048...2047 (ADS1015) */
+        int16_t getNativeResult(){
+            return Traits::toResult(readRegister(ADS1115_CONV_REG));
+        }
+
+        int32_t getResult_uV(){
+            return rawToMicrovolts(getRawResult());
+        }
+
+        /* Integer millivolts (rounded), not to be confused with the float getResult_mV() of 
+         * ADS1115_WE, which is still available */
+        int16_t getResult_mV_int(){
+            return rawToMillivolts(getRawResult());
+        }
+
+    private:
+        /* delayMicroseconds() is only accurate up to 16383 µs on AVR boards, see delayMicros() */
+        template<uint32_t US>
+        static void delayFixed(){
+            if(US >= 1000){
+                delay(US / 1000);
+            }
+            delayMicroseconds(US % 1000);
+        }
+};
+
+template<ADS1X15_CHIP CHIP, uint8_t ADDRESS, ADS1115_RANGE RANGE, ADS1115_CONV_RATE RATE>
+constexpr uint16_t ADS1x15<CHIP, ADDRESS, RANGE, RATE>::VOLTAGE_RANGE_MV;
+template<ADS1X15_CHIP CHIP, uint8_t ADDRESS, ADS1115_RANGE RANGE, ADS1115_CONV_RATE RATE>
+constexpr uint8_t ADS1x15<CHIP, ADDRESS, RANGE, RATE>::RANGE_FACTOR;
+template<ADS1X15_CHIP CHIP, uint8_t ADDRESS, ADS1115_RANGE RANGE, ADS1115_CONV_RATE RATE>
+constexpr uint32_t ADS1x15<CHIP, ADDRESS, RANGE, RATE>::CONV_TIME_US;
+template<ADS1X15_CHIP CHIP, uint8_t ADDRESS, ADS1115_RANGE RANGE, ADS1115_CONV_RATE RATE>
+constexpr uint32_t ADS1x15<CHIP, ADDRESS, RANGE, RATE>::MIN_CONV_TIME_US;
+template<ADS1X15_CHIP CHIP, uint8_t ADDRESS, ADS1115_RANGE RANGE, ADS1115_CONV_RATE RATE>
+constexpr uint32_t ADS1x15<CHIP, ADDRESS, RANGE, RATE>::MAX_CONV_TIME_US;
+template<ADS1X15_CHIP CHIP, uint8_t ADDRESS, ADS1115_RANGE RANGE, ADS1115_CONV_RATE RATE>
+constexpr uint32_t ADS1x15<CHIP, ADDRESS, RANGE, RATE>::POLL_INTERVAL_US;
+
+#endif